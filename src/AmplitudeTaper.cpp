@@ -0,0 +1,193 @@
+/**
+ * @file AmplitudeTaper.cpp
+ * @brief The implementation file for the Amplitude Taper.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "AmplitudeTaper.h"
+
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class AmplitudeTaper::Imple
+{
+public:
+    explicit Imple( size_t theLength )
+      : length{ theLength }
+    {
+    }
+
+    void addSegment( size_t begin, size_t end, double offset, std::initializer_list< CosineTerm > segmentTerms )
+    {
+        if ( begin >= end ) return;
+        segments.push_back( Segment{ begin, end, offset, terms.size(), segmentTerms.size() } );
+        terms.insert( terms.end(), segmentTerms.begin(), segmentTerms.end() );
+    }
+
+    // Symmetric generalized cosine taper of two terms, w(n) = a0 - a1 * cos( 2 * pi * n / ( length - 1 ) ).
+    void makeRaisedCosine( double a0, double a1 )
+    {
+        if ( 1 == length )
+            addSegment( 0, 1, 1.0, {} );
+        else
+            addSegment( 0, length, a0, { CosineTerm{ -a1, 2.0 * M_PI / static_cast< double >( length - 1 ), 0.0 } } );
+    }
+
+    const size_t length;
+    std::vector< Segment > segments{};
+    std::vector< CosineTerm > terms{};
+};
+
+constexpr size_t AmplitudeTaper::maxTerms;
+
+AmplitudeTaper::AmplitudeTaper( size_t length )
+  : pImple{ new Imple{ length } }
+{
+}
+
+AmplitudeTaper::~AmplitudeTaper()
+{
+    delete pImple;
+}
+
+AmplitudeTaper::AmplitudeTaper( const AmplitudeTaper & another )
+  : pImple{ new Imple{ *another.pImple } }
+{
+}
+
+AmplitudeTaper & AmplitudeTaper::operator=( const AmplitudeTaper & another )
+{
+    if ( this != &another )
+    {
+        auto pNew = new Imple{ *another.pImple };
+        delete pImple;
+        pImple = pNew;
+    }
+    return *this;
+}
+
+AmplitudeTaper AmplitudeTaper::hann( size_t length )
+{
+    AmplitudeTaper taper{ length };
+    taper.pImple->makeRaisedCosine( 0.5, 0.5 );
+    return taper;
+}
+
+AmplitudeTaper AmplitudeTaper::hamming( size_t length )
+{
+    AmplitudeTaper taper{ length };
+    taper.pImple->makeRaisedCosine( 0.54, 0.46 );
+    return taper;
+}
+
+AmplitudeTaper AmplitudeTaper::tukey( size_t length, double alpha )
+{
+    if ( alpha >= 1.0 ) return hann( length );
+
+    AmplitudeTaper taper{ length };
+    auto & imple = *taper.pImple;
+    if ( alpha <= 0.0 || length < 2 )
+    {
+        imple.addSegment( 0, length, 1.0, {} );
+        return taper;
+    }
+
+    // The edges, each spanning samples [0, width] and [length - width - 1, length), follow the
+    // conventional (e.g., SciPy) definition.
+    const auto span = alpha * static_cast< double >( length - 1 );
+    const auto width = static_cast< size_t >( std::floor( span / 2.0 ) );
+    const auto omega = 2.0 * M_PI / span;
+    imple.addSegment( 0, width + 1, 0.5, { CosineTerm{ 0.5, omega, -M_PI } } );
+    imple.addSegment( width + 1, length - width - 1, 1.0, {} );
+    imple.addSegment( length - width - 1, length, 0.5, { CosineTerm{ 0.5, omega, M_PI * ( 1.0 - 2.0 / alpha ) } } );
+    return taper;
+}
+
+AmplitudeTaper AmplitudeTaper::taylor( size_t length, unsigned nBar, double sidelobeLevel )
+{
+    if ( nBar > maxTerms + 1 )
+        throw std::invalid_argument{ "AmplitudeTaper::taylor nBar exceeds maxTerms + 1" };
+
+    AmplitudeTaper taper{ length };
+    auto & imple = *taper.pImple;
+    if ( length < 2 || nBar < 2 )
+    {
+        imple.addSegment( 0, length, 1.0, {} );
+        return taper;
+    }
+
+    // Taylor coefficients, as given by Carrara et al.
+    const auto a = std::acosh( std::pow( 10.0, sidelobeLevel / 20.0 ) ) / M_PI;
+    const auto nb = static_cast< double >( nBar );
+    const auto sigmaSquared = nb * nb / ( a * a + ( nb - 0.5 ) * ( nb - 0.5 ) );
+    std::vector< double > coefficients( nBar - 1 );
+    for ( unsigned m = 1; nBar != m; ++m )
+    {
+        const auto mm = static_cast< double >( m );
+        double numerator = 1.0;
+        double denominator = 1.0;
+        for ( unsigned i = 1; nBar != i; ++i )
+        {
+            const auto ii = static_cast< double >( i );
+            numerator *= 1.0 - mm * mm / sigmaSquared / ( a * a + ( ii - 0.5 ) * ( ii - 0.5 ) );
+            if ( i != m ) denominator *= 1.0 - mm * mm / ( ii * ii );
+        }
+        coefficients[ m - 1 ] = ( m & 0x1 ? 0.5 : -0.5 ) * numerator / denominator;
+    }
+
+    // w(n) = 1 + 2 * sum( F_m * cos( 2 * pi * m * ( n - ( length - 1 ) / 2 ) / length ) ), normalized
+    // to unit weight at the center.
+    double center = 1.0;
+    for ( const auto f : coefficients ) center += 2.0 * f;
+
+    const auto len = static_cast< double >( length );
+    imple.segments.push_back( Segment{ 0, length, 1.0 / center, 0, nBar - 1 } );
+    for ( unsigned m = 1; nBar != m; ++m )
+    {
+        const auto omega = 2.0 * M_PI * static_cast< double >( m ) / len;
+        imple.terms.push_back( CosineTerm{ 2.0 * coefficients[ m - 1 ] / center, omega, -omega * ( len - 1.0 ) / 2.0 } );
+    }
+    return taper;
+}
+
+size_t AmplitudeTaper::getLength() const
+{
+    return pImple->length;
+}
+
+size_t AmplitudeTaper::getNumSegments() const
+{
+    return pImple->segments.size();
+}
+
+const AmplitudeTaper::Segment * AmplitudeTaper::getSegments() const
+{
+    return pImple->segments.data();
+}
+
+const AmplitudeTaper::CosineTerm * AmplitudeTaper::getTerms() const
+{
+    return pImple->terms.data();
+}
+
+double AmplitudeTaper::valueAt( size_t n ) const
+{
+    for ( const auto & segment : pImple->segments )
+    {
+        if ( n < segment.begin || n >= segment.end ) continue;
+        auto w = segment.offset;
+        const auto x = static_cast< double >( n );
+        for ( size_t k = 0; segment.numTerms != k; ++k )
+        {
+            const auto & term = pImple->terms[ segment.firstTerm + k ];
+            w += term.amplitude * std::cos( term.omega * x + term.phase );
+        }
+        return w;
+    }
+    return 0.0;
+}
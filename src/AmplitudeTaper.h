@@ -0,0 +1,183 @@
+/**
+ * @file AmplitudeTaper.h
+ * @brief The specification file for the Amplitude Taper.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_AMPLITUDETAPER_H
+#define REISER_RT_AMPLITUDETAPER_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Amplitude Taper
+         *
+         * This class describes an amplitude taper (window) of a given length as a series of contiguous segments.
+         * Within a segment, the weight is a constant plus a sum of cosine terms,
+         * w(n) = offset + sum( amplitude_k * cos( omega_k * n + phase_k ) ), where n is the taper sample index.
+         * This form covers the raised cosine family (Hann, Hamming), the Taylor window, and the edges of the
+         * Tukey window. A segment with no cosine terms and an offset of one is flat and requires no weighting.
+         *
+         * The ChirpingPhasorToneGenerator's getSamplesTapered operation applies a taper within its generation
+         * loop. Each cosine term is produced by a rotating phasor recursion, so no cosine invocations are made
+         * per sample, and flat segments are generated without any weighting at all.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT AmplitudeTaper
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Cosine Term
+             */
+            struct CosineTerm
+            {
+                double amplitude;   //!< Amplitude of the term.
+                double omega;       //!< Angular rate of the term in radians per sample.
+                double phase;       //!< Phase of the term at taper sample zero in radians.
+            };
+
+            /**
+             * @brief Segment
+             */
+            struct Segment
+            {
+                size_t begin;       //!< First taper sample of the segment.
+                size_t end;         //!< One past the last taper sample of the segment.
+                double offset;      //!< Constant part of the weight.
+                size_t firstTerm;   //!< Index of the segment's first cosine term.
+                size_t numTerms;    //!< Number of cosine terms of the segment.
+            };
+
+            /**
+             * @brief The maximum number of cosine terms of any segment.
+             */
+            static constexpr size_t maxTerms = 16;
+
+            /**
+             * @brief Hann Factory
+             *
+             * @param length The number of samples of the taper.
+             * @return Returns a symmetric Hann taper, w(n) = 0.5 - 0.5 * cos( 2 * pi * n / ( length - 1 ) ).
+             */
+            static AmplitudeTaper hann( size_t length );
+
+            /**
+             * @brief Hamming Factory
+             *
+             * @param length The number of samples of the taper.
+             * @return Returns a symmetric Hamming taper, w(n) = 0.54 - 0.46 * cos( 2 * pi * n / ( length - 1 ) ).
+             */
+            static AmplitudeTaper hamming( size_t length );
+
+            /**
+             * @brief Tukey Factory
+             *
+             * A flat taper with raised cosine rise and fall edges. The edges together span the fraction `alpha`
+             * of the taper. An alpha of zero (or less) yields a rectangular taper and an alpha of one (or more)
+             * yields a Hann taper.
+             *
+             * @param length The number of samples of the taper.
+             * @param alpha The fraction of the taper occupied by the edges.
+             * @return Returns a Tukey (tapered cosine) taper.
+             */
+            static AmplitudeTaper tukey( size_t length, double alpha );
+
+            /**
+             * @brief Taylor Factory
+             *
+             * @param length The number of samples of the taper.
+             * @param nBar The number of nearly constant level sidelobes adjacent to the main lobe.
+             * @param sidelobeLevel The maximum sidelobe level in decibels relative to the main lobe, a positive value.
+             * @return Returns a Taylor taper normalized to unit peak weight.
+             *
+             * @throw Throws std::invalid_argument if nBar exceeds maxTerms + 1.
+             */
+            static AmplitudeTaper taylor( size_t length, unsigned nBar=4, double sidelobeLevel=30.0 );
+
+            /**
+             * @brief Destructor
+             */
+            ~AmplitudeTaper();
+
+            /**
+             * @brief Copy Constructor
+             *
+             * @param another Another instance to copy.
+             */
+            AmplitudeTaper( const AmplitudeTaper & another );
+
+            /**
+             * @brief Copy Assignment
+             *
+             * @param another Another instance to copy.
+             * @return Returns a reference to this instance.
+             */
+            AmplitudeTaper & operator=( const AmplitudeTaper & another );
+
+            /**
+             * @brief Get Length
+             *
+             * @return Returns the number of samples of the taper.
+             */
+            size_t getLength() const;
+
+            /**
+             * @brief Get Number of Segments
+             *
+             * @return Returns the number of segments.
+             */
+            size_t getNumSegments() const;
+
+            /**
+             * @brief Get Segments
+             *
+             * @return Returns a pointer to the array of segments, ordered and contiguous.
+             */
+            const Segment * getSegments() const;
+
+            /**
+             * @brief Get Terms
+             *
+             * @return Returns a pointer to the array of cosine terms, indexed by the segments.
+             */
+            const CosineTerm * getTerms() const;
+
+            /**
+             * @brief Value At
+             *
+             * Evaluates the taper weight directly, invoking the cosine function. This is intended for
+             * reference purposes. Taper samples beyond the length of the taper are weighted by zero.
+             *
+             * @param n The taper sample index.
+             * @return Returns the weight at the taper sample index.
+             */
+            double valueAt( size_t n ) const;
+
+        private:
+            /**
+             * @brief Constructor
+             *
+             * Instances are created by the factory operations.
+             *
+             * @param length The number of samples of the taper.
+             */
+            explicit AmplitudeTaper( size_t length );
+
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_AMPLITUDETAPER_H
@@ -0,0 +1,95 @@
+/**
+ * @file BatchSinCos.h
+ * @brief A private, vectorizable cosine and sine of a batch of angles.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_BATCHSINCOS_H
+#define REISER_RT_BATCHSINCOS_H
+
+#include <cmath>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Batch Cosine and Sine
+         *
+         * Computes the cosines and sines of a contiguous array of angles. The argument is reduced to
+         * [-pi/4, pi/4], as a head and tail pair, by a Cody-Waite reduction and the cosine and sine are
+         * evaluated with the minimax polynomial kernels of fdlibm. The quadrant is selected arithmetically,
+         * with rounding to an integer performed by adding and subtracting 1.5 * 2^52, so the loop holds no calls
+         * or branches and compilers vectorize it.
+         *
+         * Results are within an ulp of std::cos and std::sin, but are not always identical to them.
+         * Angles of magnitude beyond 2^19 * pi/2, which the reduction does not cover, and non finite angles
+         * are recomputed afterward with std::cos and std::sin.
+         *
+         * @param pAngles Array of angles in radians.
+         * @param pCos User provided array of numAngles cosines to be overwritten.
+         * @param pSin User provided array of numAngles sines to be overwritten.
+         * @param numAngles The number of angles.
+         */
+        inline void batchSinCos( const double * pAngles, double * pCos, double * pSin, size_t numAngles )
+        {
+            constexpr double twoOverPi = 6.36619772367581382433e-01;
+            constexpr double roundingBias = 6755399441055744.0;     // 1.5 * 2^52
+            constexpr double maxAngle = 823549.6627058570;          // 2^19 * pi/2
+
+            for ( size_t i = 0; numAngles != i; ++i )
+            {
+                const double x = pAngles[i];
+
+                // Nearest multiple of pi/2, and its quadrant.
+                const double fk = ( x * twoOverPi + roundingBias ) - roundingBias;
+                const double fk4 = ( fk * 0.25 - 0.375 + roundingBias ) - roundingBias;   // floor( fk / 4 )
+                const double q = fk - 4.0 * fk4;
+
+                // Reduce by pi/2 held in three parts. The leading parts have enough trailing zero bits
+                // that their products with fk are exact.
+                const double r1 = x - fk * 1.57079632673412561417e+00;
+                const double w1 = fk * 6.07710050630396597660e-11;
+                const double r2 = r1 - w1;
+                const double w2 = fk * 2.02226624879595063154e-21 - ( ( r1 - r2 ) - w1 );
+                const double r = r2 - w2;
+                const double y = ( r2 - r ) - w2;
+
+                const double z = r * r;
+                const double v = z * r;
+                const double sr = 8.33333333332248946124e-03 + z * ( -1.98412698298579493134e-04
+                                + z * ( 2.75573137070700676789e-06 + z * ( -2.50507602534068634195e-08
+                                + z * 1.58969099521155010221e-10 ) ) );
+                const double s = r - ( ( z * ( 0.5 * y - v * sr ) - y ) - v * -1.66666666666666324348e-01 );
+
+                const double cr = z * ( 4.16666666666666019037e-02 + z * ( -1.38888888888741095749e-03
+                                + z * ( 2.48015872894767294178e-05 + z * ( -2.75573143513906633035e-07
+                                + z * ( 2.08757232129817482790e-09 + z * -1.13596475577881948265e-11 ) ) ) ) );
+                const double hz = 0.5 * z;
+                const double w = 1.0 - hz;
+                const double c = w + ( ( ( 1.0 - w ) - hz ) + ( z * cr - r * y ) );
+
+                // Quadrants 0 through 3 yield ( c, s ), ( -s, c ), ( -c, -s ) and ( s, -c ).
+                const bool odd = 1.0 == q || 3.0 == q;
+                const double a = odd ? s : c;
+                const double b = odd ? c : s;
+                pCos[i] = 1.0 == q || 2.0 == q ? -a : a;
+                pSin[i] = 2.0 <= q ? -b : b;
+            }
+
+            for ( size_t i = 0; numAngles != i; ++i )
+            {
+                const double x = pAngles[i];
+                if ( !( std::fabs( x ) <= maxAngle ) )
+                {
+                    pCos[i] = std::cos( x );
+                    pSin[i] = std::sin( x );
+                }
+            }
+        }
+    }
+}
+
+#endif //REISER_RT_BATCHSINCOS_H
@@ -0,0 +1,187 @@
+/**
+ * @file ChirpArrayFanOut.cpp
+ * @brief The implementation file for the Chirp Array Fan Out.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "ChirpArrayFanOut.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class ChirpArrayFanOut::Imple
+{
+public:
+    // The number of samples per element processed in a tile. Sized so that a tile of history
+    // and a tile of an element's output fit comfortably in L1 cache.
+    static constexpr size_t tileSize = 256;
+
+    Imple( double theAccel, double theOmegaZero, double thePhi, const ElementSteering * pSteering, size_t numElements )
+      : accel{ theAccel }
+      , omegaZero{ theOmegaZero }
+      , phi{ thePhi }
+      , steering( pSteering, pSteering + numElements )
+      , delays( numElements )
+      , phasorRe( numElements )
+      , phasorIm( numElements )
+      , rateRe( numElements )
+      , rateIm( numElements )
+    {
+        for ( size_t e = 0; numElements != e; ++e )
+        {
+            if ( steering[e].delay < 0.0 )
+                throw std::invalid_argument{ "ChirpArrayFanOut delays must be non-negative" };
+            delays[e] = std::ptrdiff_t( std::floor( steering[e].delay ) );
+            maxDelay = std::max( maxDelay, delays[e] );
+        }
+        history.resize( size_t( maxDelay ) + tileSize );
+        reset();
+    }
+
+    void reset()
+    {
+        base.reset( accel, omegaZero, phi );
+        sampleCount = 0;
+
+        // History prior to the start of the pulse is zero so that elements remain silent until it arrives.
+        std::fill( history.begin(), history.end(), FlyingPhasorElementType{} );
+
+        // Each steering phasor is established at output sample zero which is sample -delay of its view.
+        // With delay = D + tau, the phasor at view sample m is,
+        // exp( j * ( phase - omegaZero * tau + 0.5 * accel * tau^2 - accel * tau * m ) ).
+        for ( size_t e = 0; steering.size() != e; ++e )
+        {
+            const auto tau = steering[e].delay - double( delays[e] );
+            const auto m = -double( delays[e] );
+            const auto phase = steering[e].phase - omegaZero * tau + 0.5 * accel * tau * tau - accel * tau * m;
+            phasorRe[e] = std::cos( phase );
+            phasorIm[e] = std::sin( phase );
+            rateRe[e] = std::cos( -accel * tau );
+            rateIm[e] = std::sin( -accel * tau );
+        }
+    }
+
+    void getSamples( FlyingPhasorElementBufferTypePtr pOut, size_t numSamples, Layout layout )
+    {
+        const auto numElements = steering.size();
+        for ( size_t t0 = 0; numSamples != t0; )
+        {
+            const auto count = std::min( tileSize, numSamples - t0 );
+
+            // Advance the one and only chirp recursion for this tile.
+            const auto pHist = history.data() + maxDelay;
+            base.getSamples( pHist, count );
+
+            if ( Layout::ElementMajor == layout )
+            {
+                for ( size_t e = 0; numElements != e; ++e )
+                {
+                    const auto pView = pHist - delays[e];
+                    auto pDst = pOut + e * numSamples + t0;
+                    FlyingPhasorElementType ph{ phasorRe[e], phasorIm[e] };
+                    const FlyingPhasorElementType rate{ rateRe[e], rateIm[e] };
+                    for ( size_t t = 0; count != t; ++t )
+                    {
+                        pDst[t] = pView[t] * ph;
+                        ph *= rate;
+                    }
+                    phasorRe[e] = ph.real();
+                    phasorIm[e] = ph.imag();
+                }
+            }
+            else
+            {
+                // Element arrays are kept in split real/imaginary form so that this inner loop vectorizes.
+                const auto pDelays = delays.data();
+                const auto pPhRe = phasorRe.data();
+                const auto pPhIm = phasorIm.data();
+                const auto pRateRe = rateRe.data();
+                const auto pRateIm = rateIm.data();
+                for ( size_t t = 0; count != t; ++t )
+                {
+                    auto pDst = pOut + ( t0 + t ) * numElements;
+                    for ( size_t e = 0; numElements != e; ++e )
+                    {
+                        const auto & x = pHist[ std::ptrdiff_t( t ) - pDelays[e] ];
+                        const auto re = pPhRe[e];
+                        const auto im = pPhIm[e];
+                        pDst[e] = FlyingPhasorElementType{ x.real() * re - x.imag() * im, x.real() * im + x.imag() * re };
+                        pPhRe[e] = re * pRateRe[e] - im * pRateIm[e];
+                        pPhIm[e] = re * pRateIm[e] + im * pRateRe[e];
+                    }
+                }
+            }
+
+            // Re-normalize the steering phasors once per tile. As with the ChirpingPhasorToneGenerator,
+            // a first order Taylor Series approximation of the square root suffices.
+            for ( size_t e = 0; numElements != e; ++e )
+            {
+                const auto d = 1.0 - ( phasorRe[e] * phasorRe[e] + phasorIm[e] * phasorIm[e] - 1.0 ) / 2.0;
+                phasorRe[e] *= d;
+                phasorIm[e] *= d;
+            }
+
+            // Retain the most recent maxDelay samples of history for the next tile.
+            std::copy( history.begin() + std::ptrdiff_t( count ), history.begin() + std::ptrdiff_t( count ) + maxDelay,
+                       history.begin() );
+
+            t0 += count;
+            sampleCount += count;
+        }
+    }
+
+    const double accel;
+    const double omegaZero;
+    const double phi;
+    const std::vector< ElementSteering > steering;
+    std::vector< std::ptrdiff_t > delays{};
+    std::ptrdiff_t maxDelay{};
+
+    ChirpingPhasorToneGenerator base{};
+    std::vector< FlyingPhasorElementType > history{};
+    std::vector< double > phasorRe;
+    std::vector< double > phasorIm;
+    std::vector< double > rateRe;
+    std::vector< double > rateIm;
+    size_t sampleCount{};
+};
+
+constexpr size_t ChirpArrayFanOut::Imple::tileSize;
+
+ChirpArrayFanOut::ChirpArrayFanOut( double accel, double omegaZero, double phi,
+                                    const ElementSteering * pSteering, size_t numElements )
+  : pImple{ new Imple{ accel, omegaZero, phi, pSteering, numElements } }
+{
+}
+
+ChirpArrayFanOut::~ChirpArrayFanOut()
+{
+    delete pImple;
+}
+
+void ChirpArrayFanOut::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, Layout layout )
+{
+    pImple->getSamples( pElementBuffer, numSamples, layout );
+}
+
+void ChirpArrayFanOut::reset()
+{
+    pImple->reset();
+}
+
+size_t ChirpArrayFanOut::getNumElements() const
+{
+    return pImple->steering.size();
+}
+
+size_t ChirpArrayFanOut::getSampleCount() const
+{
+    return pImple->sampleCount;
+}
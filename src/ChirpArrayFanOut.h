@@ -0,0 +1,125 @@
+/**
+ * @file ChirpArrayFanOut.h
+ * @brief The specification file for the Chirp Array Fan Out.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_CHIRPARRAYFANOUT_H
+#define REISER_RT_CHIRPARRAYFANOUT_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Chirp Array Fan Out
+         *
+         * This class produces the same chirp on many array elements, each with its own steering phase and
+         * delay, from a single chirp recursion. The base chirp, as delivered by a ChirpingPhasorToneGenerator,
+         * is advanced once per sample into a shared history. Each element output is an offset view into that
+         * history (its integer delay), multiplied by a per element steering phasor.
+         *
+         * Fractional delays are exact for a linear chirp. Delaying, theta(n) = phi + omegaZero * n + 0.5 * accel * n^2,
+         * by tau samples subtracts, omega(n) * tau - 0.5 * accel * tau^2, from the phase, which is linear in n.
+         * Hence a fractional delay is simply a steering phasor that rotates at a constant rate of -accel * tau
+         * radians per sample (a FlyingPhasorToneGenerator style recursion). Only the leading edge of the
+         * pulse is quantized to the integer delay. Element outputs are zero until their pulse arrives.
+         *
+         * Output is produced in cache sized tiles of time, in either element major or time major layout.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT ChirpArrayFanOut
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Output Layout
+             *
+             * ElementMajor places each element's samples contiguously, pBuffer[ element * numSamples + sample ].
+             * TimeMajor places each sample time's elements contiguously, pBuffer[ sample * numElements + element ].
+             */
+            enum class Layout : short { ElementMajor, TimeMajor };
+
+            /**
+             * @brief Element Steering
+             *
+             * The steering of an individual element.
+             */
+            struct ElementSteering
+            {
+                double phase;   //!< Steering phase offset in radians.
+                double delay;   //!< Non-negative delay in samples, may be fractional.
+            };
+
+            /**
+             * @brief Constructor
+             *
+             * @param accel Acceleration in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity in radians per sample.
+             * @param phi Starting phase angle in radians.
+             * @param pSteering Array of element steering, copied.
+             * @param numElements Number of elements.
+             *
+             * @throw Throws std::invalid_argument if any delay is negative.
+             */
+            ChirpArrayFanOut( double accel, double omegaZero, double phi,
+                              const ElementSteering * pSteering, size_t numElements );
+
+            /**
+             * @brief Destructor
+             */
+            ~ChirpArrayFanOut();
+
+            ChirpArrayFanOut( const ChirpArrayFanOut & another ) = delete;
+            ChirpArrayFanOut & operator=( const ChirpArrayFanOut & another ) = delete;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' samples for every element into the user provided buffer. Subsequent invocations
+             * continue on in phase with those previous.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold numSamples times the number
+             * of elements.
+             * @param numSamples The number of samples per element to be delivered.
+             * @param layout The layout of the delivered samples.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, Layout layout );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Restarts the pulse from sample zero on every element.
+             */
+            void reset();
+
+            /**
+             * @brief Get Number of Elements
+             *
+             * @return Returns the number of elements.
+             */
+            size_t getNumElements() const;
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @return Returns the number of samples delivered per element since construction or reset.
+             */
+            size_t getSampleCount() const;
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_CHIRPARRAYFANOUT_H
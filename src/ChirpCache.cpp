@@ -0,0 +1,230 @@
+/**
+ * @file ChirpCache.cpp
+ * @brief The implementation file for the Chirp Cache.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "ChirpCache.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Sample blocks are aligned to a cache line.
+    constexpr size_t blockAlignment = 64;
+
+    // Cache key. Parameters are compared bitwise so that lookups are exact.
+    struct Key
+    {
+        uint64_t accel;
+        uint64_t omegaZero;
+        uint64_t phi;
+        uint64_t length;
+        bool rotated;
+
+        bool operator==( const Key & other ) const
+        {
+            return accel == other.accel && omegaZero == other.omegaZero && phi == other.phi &&
+                   length == other.length && rotated == other.rotated;
+        }
+    };
+
+    inline uint64_t toBits( double value )
+    {
+        uint64_t bits;
+        std::memcpy( &bits, &value, sizeof( bits ) );
+        return bits;
+    }
+
+    struct KeyHash
+    {
+        size_t operator()( const Key & key ) const
+        {
+            // Boost style hash combining.
+            std::hash< uint64_t > hasher{};
+            size_t seed = hasher( key.accel );
+            seed ^= hasher( key.omegaZero ) + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+            seed ^= hasher( key.phi ) + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+            seed ^= hasher( key.length ) + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 );
+            return seed ^ size_t( key.rotated );
+        }
+    };
+
+    // Allocates an aligned, uninitialized block of samples whose lifetime is governed by the returned span.
+    ChirpSpan allocateBlock( size_t numSamples, size_t & bytesAllocated )
+    {
+        bytesAllocated = numSamples * sizeof( FlyingPhasorElementType ) + blockAlignment - 1;
+        std::shared_ptr< unsigned char > pRaw{ new unsigned char[ bytesAllocated ],
+                                               std::default_delete< unsigned char[] >() };
+        const auto address = reinterpret_cast< uintptr_t >( pRaw.get() );
+        const auto aligned = ( address + blockAlignment - 1 ) & ~uintptr_t( blockAlignment - 1 );
+        auto pSamples = reinterpret_cast< FlyingPhasorElementType * >( aligned );
+        return ChirpSpan{ std::move( pRaw ), pSamples, numSamples };
+    }
+
+    // Generates a pulse into a newly allocated block.
+    ChirpSpan generatePulse( double accel, double omegaZero, double phi, size_t length, size_t & bytesAllocated )
+    {
+        auto span = allocateBlock( length, bytesAllocated );
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        chirpGen.getSamples( const_cast< FlyingPhasorElementBufferTypePtr >( span.data() ), length );
+        return span;
+    }
+}
+
+class ChirpCache::Imple
+{
+public:
+    explicit Imple( size_t theMemoryBudget ) : memoryBudget{ theMemoryBudget } {}
+
+    // Looks a key up, promoting it to most recently used on a hit. Returns an empty span on a miss.
+    // Only lookups which are requests in their own right are counted.
+    ChirpSpan find( const Key & key, bool counted=true )
+    {
+        std::lock_guard< std::mutex > lock{ mutex };
+        auto iter = index.find( key );
+        if ( index.end() == iter )
+        {
+            if ( counted ) ++misses;
+            return ChirpSpan{};
+        }
+        if ( counted ) ++hits;
+        lruList.splice( lruList.begin(), lruList, iter->second );
+        return iter->second->span;
+    }
+
+    // Inserts a newly created block, evicting least recently used blocks to remain within budget.
+    // If another thread beat us to it, theirs is returned and ours discarded.
+    ChirpSpan insert( const Key & key, const ChirpSpan & span, size_t bytes )
+    {
+        std::lock_guard< std::mutex > lock{ mutex };
+        auto iter = index.find( key );
+        if ( index.end() != iter ) return iter->second->span;
+
+        // Blocks larger than our entire budget are handed out but not retained.
+        if ( bytes > memoryBudget ) return span;
+
+        while ( bytesCached + bytes > memoryBudget )
+        {
+            bytesCached -= lruList.back().bytes;
+            index.erase( lruList.back().key );
+            lruList.pop_back();
+        }
+
+        lruList.push_front( Entry{ key, span, bytes } );
+        index.emplace( key, lruList.begin() );
+        bytesCached += bytes;
+        return span;
+    }
+
+    void clear()
+    {
+        std::lock_guard< std::mutex > lock{ mutex };
+        index.clear();
+        lruList.clear();
+        bytesCached = 0;
+        hits = 0;
+        misses = 0;
+    }
+
+    struct Entry
+    {
+        Key key;
+        ChirpSpan span;
+        size_t bytes;
+    };
+    using EntryList = std::list< Entry >;
+
+    mutable std::mutex mutex{};
+    EntryList lruList{};
+    std::unordered_map< Key, EntryList::iterator, KeyHash > index{};
+    const size_t memoryBudget;
+    size_t bytesCached{};
+    size_t hits{};
+    size_t misses{};
+};
+
+ChirpCache::ChirpCache( size_t memoryBudget )
+  : pImple{ new Imple{ memoryBudget } }
+{
+}
+
+ChirpCache::~ChirpCache()
+{
+    delete pImple;
+}
+
+ChirpSpan ChirpCache::getPulse( double accel, double omegaZero, double phi, size_t length )
+{
+    const Key key{ toBits( accel ), toBits( omegaZero ), toBits( phi ), length, false };
+    auto span = pImple->find( key );
+    if ( !span.empty() || 0 == length ) return span;
+
+    // Generate outside the lock.
+    size_t bytes;
+    span = generatePulse( accel, omegaZero, phi, length, bytes );
+    return pImple->insert( key, span, bytes );
+}
+
+ChirpSpan ChirpCache::getPulsePhaseOffset( double accel, double omegaZero, double phi, size_t length )
+{
+    // A phi of zero is simply the base pulse.
+    if ( 0.0 == phi ) return getPulse( accel, omegaZero, phi, length );
+
+    const Key key{ toBits( accel ), toBits( omegaZero ), toBits( phi ), length, true };
+    auto span = pImple->find( key );
+    if ( !span.empty() || 0 == length ) return span;
+
+    // The base pulse is obtained as part of this same request, so its lookup is not counted again.
+    // It is generated and cached if absent.
+    size_t bytes;
+    const Key baseKey{ toBits( accel ), toBits( omegaZero ), toBits( 0.0 ), length, false };
+    auto base = pImple->find( baseKey, false );
+    if ( base.empty() )
+    {
+        base = generatePulse( accel, omegaZero, 0.0, length, bytes );
+        base = pImple->insert( baseKey, base, bytes );
+    }
+
+    // Rotate the base pulse, outside the lock, by the phase offset. One complex multiply per sample.
+    span = allocateBlock( length, bytes );
+    auto pOut = const_cast< FlyingPhasorElementBufferTypePtr >( span.data() );
+    const auto pIn = base.data();
+    const auto rotation = std::polar( 1.0, phi );
+    for ( size_t i = 0; length != i; ++i )
+        pOut[i] = pIn[i] * rotation;
+
+    return pImple->insert( key, span, bytes );
+}
+
+size_t ChirpCache::getHitCount() const
+{
+    std::lock_guard< std::mutex > lock{ pImple->mutex };
+    return pImple->hits;
+}
+
+size_t ChirpCache::getMissCount() const
+{
+    std::lock_guard< std::mutex > lock{ pImple->mutex };
+    return pImple->misses;
+}
+
+size_t ChirpCache::getBytesCached() const
+{
+    std::lock_guard< std::mutex > lock{ pImple->mutex };
+    return pImple->bytesCached;
+}
+
+void ChirpCache::clear()
+{
+    pImple->clear();
+}
@@ -0,0 +1,167 @@
+/**
+ * @file ChirpCache.h
+ * @brief The specification file for the Chirp Cache.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_CHIRPCACHE_H
+#define REISER_RT_CHIRPCACHE_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <memory>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Chirp Span
+         *
+         * A read-only view of a cached chirp pulse. The span shares ownership of the underlying
+         * sample block, so the block remains valid for as long as the span exists, even if the cache
+         * has since evicted it. Spans may be freely copied and shared between threads.
+         */
+        class ChirpSpan
+        {
+        public:
+            ChirpSpan() = default;
+
+            /**
+             * @brief Qualified Constructor
+             *
+             * @param keepAlive Shared ownership of the memory holding the samples.
+             * @param pSamples Pointer to the first sample.
+             * @param numSamples Number of samples.
+             */
+            ChirpSpan( std::shared_ptr< const void > keepAlive, const FlyingPhasorElementType * pSamples,
+                       size_t numSamples )
+              : keepAlive{ std::move( keepAlive ) }
+              , pSamples{ pSamples }
+              , numSamples{ numSamples }
+            {
+            }
+
+            inline const FlyingPhasorElementType * data() const { return pSamples; }
+            inline size_t size() const { return numSamples; }
+            inline bool empty() const { return 0 == numSamples; }
+            inline const FlyingPhasorElementType * begin() const { return pSamples; }
+            inline const FlyingPhasorElementType * end() const { return pSamples + numSamples; }
+            inline const FlyingPhasorElementType & operator[]( size_t i ) const { return pSamples[i]; }
+
+        private:
+            std::shared_ptr< const void > keepAlive{};          //!< Keeps the sample block alive.
+            const FlyingPhasorElementType * pSamples{ nullptr }; //!< The first sample.
+            size_t numSamples{};                                 //!< The number of samples.
+        };
+
+        /**
+         * @brief Chirp Cache
+         *
+         * This class maintains a cache of generated chirp pulses keyed on their
+         * (accel, omegaZero, phi, length) parameters. Schedulers which request the same pulses over and over
+         * obtain them from the cache instead of invoking ChirpingPhasorToneGenerator reset and getSamples
+         * operations again. Sample blocks are aligned on 64 byte boundaries. The memory held by cached blocks
+         * is kept under a configurable budget by evicting the least recently used blocks.
+         *
+         * All operations are thread safe. Generation on a miss occurs outside of the internal lock.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT ChirpCache
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Constructor
+             *
+             * @param memoryBudget The maximum number of bytes of sample blocks to retain.
+             */
+            explicit ChirpCache( size_t memoryBudget );
+
+            /**
+             * @brief Destructor
+             *
+             * Releases the cache's ownership of all blocks. Outstanding spans remain valid.
+             */
+            ~ChirpCache();
+
+            ChirpCache( const ChirpCache & another ) = delete;
+            ChirpCache & operator=( const ChirpCache & another ) = delete;
+
+            /**
+             * @brief Get Pulse Operation
+             *
+             * Obtains a pulse of `length` samples as generated by a ChirpingPhasorToneGenerator constructed
+             * with the given parameters. The pulse is generated and cached on a miss.
+             *
+             * @param accel Acceleration in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity in radians per sample.
+             * @param phi Starting phase angle in radians.
+             * @param length The number of samples in the pulse.
+             *
+             * @return Returns a read-only span of the pulse samples.
+             */
+            ChirpSpan getPulse( double accel, double omegaZero, double phi, size_t length );
+
+            /**
+             * @brief Get Phase Offset Pulse Operation
+             *
+             * Obtains a pulse as the getPulse operation does, except that a miss is satisfied by a single
+             * rotation of the pulse with a phi of zero (itself obtained through the cache), instead of
+             * regenerating. The rotated pulse is cached separately from those obtained by getPulse, so that
+             * getPulse always delivers exactly what the generator would. The two agree to within rounding.
+             *
+             * Each invocation counts as a single hit or miss. Note, however, that a rotated pulse and its base
+             * pulse are both retained and so both are charged against the memory budget.
+             *
+             * @param accel Acceleration in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity in radians per sample.
+             * @param phi Starting phase angle in radians.
+             * @param length The number of samples in the pulse.
+             *
+             * @return Returns a read-only span of the pulse samples.
+             */
+            ChirpSpan getPulsePhaseOffset( double accel, double omegaZero, double phi, size_t length );
+
+            /**
+             * @brief Get Hit Count
+             *
+             * @return Returns the number of requests satisfied directly from the cache.
+             */
+            size_t getHitCount() const;
+
+            /**
+             * @brief Get Miss Count
+             *
+             * @return Returns the number of requests that required generation or rotation.
+             */
+            size_t getMissCount() const;
+
+            /**
+             * @brief Get Bytes Cached
+             *
+             * @return Returns the number of bytes currently retained by the cache.
+             */
+            size_t getBytesCached() const;
+
+            /**
+             * @brief Clear Operation
+             *
+             * Releases the cache's ownership of all blocks and zeroes the hit and miss counts.
+             */
+            void clear();
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_CHIRPCACHE_H
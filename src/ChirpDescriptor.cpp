@@ -0,0 +1,54 @@
+/**
+ * @file ChirpDescriptor.cpp
+ * @brief The implementation file for the Chirp Descriptor.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "ChirpDescriptor.h"
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // The number of table entries processed per block by the batch operation.
+    constexpr size_t batchBlockSize = 64;
+}
+
+ChirpDescriptor::ChirpDescriptor()
+  : ChirpDescriptor{ 0.0, 0.0, 0.0 }
+{
+}
+
+ChirpDescriptor::ChirpDescriptor( double theAccel, double theOmegaZero, double thePhi )
+  : accel{ theAccel }
+  , omegaZero{ theOmegaZero }
+  , phi{ thePhi }
+  , initialState{}
+{
+    ChirpingPhasorToneGenerator::makeInitialStates( &accel, &omegaZero, &phi, 1, &initialState );
+}
+
+void ChirpDescriptor::arm( ChirpingPhasorToneGenerator & generator ) const
+{
+    generator.restoreInitialState( initialState );
+}
+
+void ChirpDescriptor::makeBatch( const double * pAccel, const double * pOmegaZero, const double * pPhi,
+                                 size_t numDescriptors, ChirpDescriptor * pDescriptors )
+{
+    ChirpingPhasorToneGenerator::StateSnapshot states[ batchBlockSize ];
+    for ( size_t i0 = 0; numDescriptors > i0; i0 += batchBlockSize )
+    {
+        const auto count = numDescriptors - i0 < batchBlockSize ? numDescriptors - i0 : batchBlockSize;
+        ChirpingPhasorToneGenerator::makeInitialStates( pAccel + i0, pOmegaZero + i0, pPhi + i0, count, states );
+        for ( size_t i = 0; count != i; ++i )
+        {
+            auto & descriptor = pDescriptors[ i0 + i ];
+            descriptor.accel = pAccel[ i0 + i ];
+            descriptor.omegaZero = pOmegaZero[ i0 + i ];
+            descriptor.phi = pPhi[ i0 + i ];
+            descriptor.initialState = states[i];
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file ChirpDescriptor.h
+ * @brief The specification file for the Chirp Descriptor.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_CHIRPDESCRIPTOR_H
+#define REISER_RT_CHIRPDESCRIPTOR_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "ChirpingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Chirp Descriptor
+         *
+         * This class holds a chirp's parameters along with the precomputed state of a ChirpingPhasorToneGenerator
+         * at sample zero. Arming a generator from a descriptor is a plain copy of that state. It stands in for
+         * invoking the generator's reset operation with the same parameters, but it invokes no transcendental
+         * functions. This suits schedulers which re-arm many short chirps from a known set of waveforms.
+         * The state is computed by ChirpingPhasorToneGenerator::makeInitialStates, whose starting phasors may
+         * differ from those of the reset operation by an ulp.
+         *
+         * Descriptors may be created in batches from a structure of arrays parameter table, with the trigonometry
+         * of the whole table computed by a vectorized batch sine and cosine. To reset many generators at once,
+         * make a batch of descriptors and arm each generator from its descriptor.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT ChirpDescriptor
+        {
+        public:
+            /**
+             * @brief Default Constructor
+             *
+             * Constructs a descriptor for a zero acceleration, zero angular velocity, zero phase chirp.
+             */
+            ChirpDescriptor();
+
+            /**
+             * @brief Constructor
+             *
+             * @param accel Acceleration in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity in radians per sample.
+             * @param phi Starting phase angle in radians.
+             */
+            ChirpDescriptor( double accel, double omegaZero, double phi );
+
+            /**
+             * @brief Arm Operation
+             *
+             * Re-arms a generator as if its reset operation were invoked with our parameters. As with reset, the
+             * generator's resync interval is preserved.
+             *
+             * @param generator The generator to be armed.
+             */
+            void arm( ChirpingPhasorToneGenerator & generator ) const;
+
+            /**
+             * @brief Make Batch Operation
+             *
+             * Creates descriptors from a structure of arrays parameter table.
+             *
+             * @param pAccel Array of accelerations in radians per sample, per sample.
+             * @param pOmegaZero Array of starting angular velocities in radians per sample.
+             * @param pPhi Array of starting phase angles in radians.
+             * @param numDescriptors The number of entries in each of the arrays.
+             * @param pDescriptors User provided array of numDescriptors descriptors to be overwritten.
+             */
+            static void makeBatch( const double * pAccel, const double * pOmegaZero, const double * pPhi,
+                                   size_t numDescriptors, ChirpDescriptor * pDescriptors );
+
+            /**
+             * @brief Get Acceleration
+             *
+             * @return Returns the acceleration in radians per sample, per sample.
+             */
+            inline double getAccel() const { return accel; }
+
+            /**
+             * @brief Get Omega Zero
+             *
+             * @return Returns the starting angular velocity in radians per sample.
+             */
+            inline double getOmegaZero() const { return omegaZero; }
+
+            /**
+             * @brief Get Phi
+             *
+             * @return Returns the starting phase angle in radians.
+             */
+            inline double getPhi() const { return phi; }
+
+            /**
+             * @brief Get Initial State
+             *
+             * @return Returns the generator state at sample zero.
+             */
+            inline const ChirpingPhasorToneGenerator::StateSnapshot & getInitialState() const { return initialState; }
+
+        private:
+            double accel;                                           //!< Acceleration.
+            double omegaZero;                                       //!< Starting angular velocity.
+            double phi;                                             //!< Starting phase.
+            ChirpingPhasorToneGenerator::StateSnapshot initialState; //!< Generator state at sample zero.
+        };
+    }
+}
+
+#endif //REISER_RT_CHIRPDESCRIPTOR_H
@@ -0,0 +1,227 @@
+/**
+ * @file ChirpHopSequenceGenerator.cpp
+ * @brief The implementation file for the Chirp Hop Sequence Generator.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "ChirpHopSequenceGenerator.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // The re-normalization of the tone generators. A first order Taylor Series approximation of 1 / sqrt around 1.
+    inline void normalize( FlyingPhasorElementType & phasor )
+    {
+        const double d = 1.0 - ( phasor.real()*phasor.real() + phasor.imag()*phasor.imag() - 1.0 ) / 2.0;
+        phasor *= d;
+    }
+}
+
+class ChirpHopSequenceGenerator::Imple
+{
+public:
+    /**
+     * @brief The precomputed recursion of a hop.
+     */
+    struct HopState
+    {
+        FlyingPhasorElementType rate;           //!< The `rate` phasor at the first sample of the hop.
+        FlyingPhasorElementType rateRate;       //!< The phasor advancing `rate` each sample.
+        FlyingPhasorElementType startPhasor;    //!< The coherent mode phasor at the first sample, of cycle zero.
+        FlyingPhasorElementType cycleRotation;  //!< The coherent mode advance of `startPhasor` per cycle.
+        size_t dwell;                           //!< The number of samples of the hop.
+    };
+
+    Imple( const Hop * pHops, size_t numHops, PhaseMode thePhaseMode, double phi )
+      : hops( numHops )
+      , nextStartPhasors( numHops )
+      , phaseMode( thePhaseMode )
+      , phasor{}
+      , rate{}
+      , rateRate{}
+      , initialPhasor{ std::polar( 1.0, phi ) }
+      , cycleLength{}
+      , hopIndex{}
+      , hopPosition{}
+      , sampleCounter{}
+    {
+        if ( !numHops )
+            throw std::invalid_argument{ "ChirpHopSequenceGenerator requires at least one hop" };
+
+        for ( size_t h = 0; numHops != h; ++h )
+        {
+            const auto & hop = pHops[h];
+            if ( !hop.dwell )
+                throw std::invalid_argument{ "ChirpHopSequenceGenerator hop dwell must be nonzero" };
+
+            auto & state = hops[h];
+            state.rate = std::polar( 1.0, hop.omegaZero + hop.accel / 2.0 );
+            state.rateRate = std::polar( 1.0, hop.accel );
+            state.dwell = hop.dwell;
+
+            // The carrier phase at the hop's first sample, referenced to sample zero. Here,
+            // the cycle length accumulated thus far is the starting sample of the hop.
+            const auto carrierPhase = std::remainder( hop.omegaZero * static_cast< double >( cycleLength ), 2.0 * M_PI );
+            state.startPhasor = std::polar( 1.0, std::remainder( phi + carrierPhase, 2.0 * M_PI ) );
+            cycleLength += hop.dwell;
+        }
+
+        // Each visit to a hop in the coherent mode begins one cycle's worth of carrier phase after the last.
+        for ( size_t h = 0; numHops != h; ++h )
+            hops[h].cycleRotation = std::polar( 1.0, std::remainder( pHops[h].omegaZero
+                                                                     * static_cast< double >( cycleLength ), 2.0 * M_PI ) );
+
+        reset();
+    }
+
+    void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+    {
+        while ( numSamples )
+        {
+            if ( hops[ hopIndex ].dwell == hopPosition )
+                beginHop( hopIndex + 1 == hops.size() ? 0 : hopIndex + 1 );
+
+            const auto remaining = hops[ hopIndex ].dwell - hopPosition;
+            const auto count = numSamples < remaining ? numSamples : remaining;
+            generateSegment( pElementBuffer, count );
+
+            pElementBuffer += count;
+            numSamples -= count;
+            hopPosition += count;
+            sampleCounter += count;
+        }
+    }
+
+    void reset()
+    {
+        for ( size_t h = 0; hops.size() != h; ++h )
+            nextStartPhasors[h] = hops[h].startPhasor;
+
+        phasor = initialPhasor;
+        beginHop( 0 );
+        sampleCounter = 0;
+    }
+
+    void beginHop( size_t index )
+    {
+        hopIndex = index;
+        hopPosition = 0;
+
+        const auto & state = hops[ index ];
+        rate = state.rate;
+        rateRate = state.rateRate;
+
+        // In the continuous mode, our phasor simply carries on from the end of the previous hop.
+        if ( PhaseMode::Coherent == phaseMode )
+        {
+            auto & nextStartPhasor = nextStartPhasors[ index ];
+            phasor = nextStartPhasor;
+            nextStartPhasor *= state.cycleRotation;
+            normalize( nextStartPhasor );
+        }
+    }
+
+    // Generates samples within the current hop. The recursion is that of the ChirpingPhasorToneGenerator,
+    // re-normalizing after every odd sample of the hop. Samples are produced in pairs, so that re-normalization
+    // needs no per sample test. Only the ends of a segment may hold an unpaired sample.
+    void generateSegment( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t count )
+    {
+        auto p = phasor;
+        auto r = rate;
+        const auto rr = rateRate;
+
+        if ( count && ( hopPosition & 0x1 ) )
+        {
+            *pElementBuffer++ = p;
+            p *= r;
+            r *= rr;
+            normalize( r );
+            normalize( p );
+            --count;
+        }
+
+        for ( auto pairs = count / 2; pairs; --pairs )
+        {
+            *pElementBuffer++ = p;
+            p *= r;
+            r *= rr;
+            *pElementBuffer++ = p;
+            p *= r;
+            r *= rr;
+            normalize( r );
+            normalize( p );
+        }
+
+        if ( count & 0x1 )
+        {
+            *pElementBuffer = p;
+            p *= r;
+            r *= rr;
+        }
+
+        phasor = p;
+        rate = r;
+    }
+
+    std::vector< HopState > hops;                                   //!< The precomputed hop table.
+    std::vector< FlyingPhasorElementType > nextStartPhasors;        //!< Coherent mode phasors for each hop's next visit.
+    const PhaseMode phaseMode;                                      //!< The phase mode.
+    FlyingPhasorElementType phasor;                                 //!< The phasor of the next sample.
+    FlyingPhasorElementType rate;                                   //!< The phasor advancing `phasor` each sample.
+    FlyingPhasorElementType rateRate;                               //!< The phasor advancing `rate` each sample.
+    const FlyingPhasorElementType initialPhasor;                    //!< The phasor of sample zero.
+    size_t cycleLength;                                             //!< The sum of all dwells.
+    size_t hopIndex;                                                //!< The index of the current hop.
+    size_t hopPosition;                                             //!< The number of samples delivered of the current hop.
+    size_t sampleCounter;                                           //!< The number of samples delivered.
+};
+
+ChirpHopSequenceGenerator::ChirpHopSequenceGenerator( const Hop * pHops, size_t numHops,
+                                                      PhaseMode phaseMode, double phi )
+  : pImple{ new Imple{ pHops, numHops, phaseMode, phi } }
+{
+}
+
+ChirpHopSequenceGenerator::~ChirpHopSequenceGenerator()
+{
+    delete pImple;
+}
+
+void ChirpHopSequenceGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->getSamples( pElementBuffer, numSamples );
+}
+
+void ChirpHopSequenceGenerator::reset()
+{
+    pImple->reset();
+}
+
+size_t ChirpHopSequenceGenerator::getNumHops() const
+{
+    return pImple->hops.size();
+}
+
+size_t ChirpHopSequenceGenerator::getCycleLength() const
+{
+    return pImple->cycleLength;
+}
+
+size_t ChirpHopSequenceGenerator::getHopIndex() const
+{
+    // Once a hop's dwell is complete, the next sample belongs to the following hop.
+    const auto & imple = *pImple;
+    if ( imple.hops[ imple.hopIndex ].dwell != imple.hopPosition ) return imple.hopIndex;
+    return imple.hopIndex + 1 == imple.hops.size() ? 0 : imple.hopIndex + 1;
+}
+
+size_t ChirpHopSequenceGenerator::getSampleCount() const
+{
+    return pImple->sampleCounter;
+}
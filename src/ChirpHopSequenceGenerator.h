@@ -0,0 +1,142 @@
+/**
+ * @file ChirpHopSequenceGenerator.h
+ * @brief The specification file for the Chirp Hop Sequence Generator.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_CHIRPHOPSEQUENCEGENERATOR_H
+#define REISER_RT_CHIRPHOPSEQUENCEGENERATOR_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Chirp Hop Sequence Generator
+         *
+         * This class produces stepped frequency and frequency hopping waveforms from a table of hops, each a chirp
+         * (or a tone, with zero acceleration) of its own starting angular velocity, acceleration and dwell in samples.
+         * The table is cycled through indefinitely. Within a hop, samples are produced by the chirp recursion of
+         * the ChirpingPhasorToneGenerator, including its every other sample re-normalization.
+         *
+         * All trigonometry is performed upon construction. The `rate` phasors of every hop, and for the coherent mode
+         * the phasor of every hop boundary, are precomputed. Samples are generated a hop segment at a time, with
+         * hop boundaries handled between segments, so there is no per sample boundary check.
+         *
+         * Two phase modes are supported:
+         * - Continuous: Each hop begins at the phase with which the previous hop ended. There are no phase
+         *   discontinuities, only angular velocity (and acceleration) discontinuities at the boundaries.
+         * - Coherent: Each hop begins at the phase its carrier would have, had the carrier been running since
+         *   sample zero of the sequence. The phase of hop h, at sample n of the sequence (counting across cycles)
+         *   and k samples into the hop, is phi + omegaZero_h * n + accel_h / 2 * k^2. The phase of every visit
+         *   to a given frequency is thus predictable, as stepped frequency processing requires.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT ChirpHopSequenceGenerator
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Phase Mode
+             */
+            enum class PhaseMode
+            {
+                Continuous,     //!< Each hop begins at the phase with which the previous hop ended.
+                Coherent        //!< Each hop begins at the phase of its carrier referenced to sample zero.
+            };
+
+            /**
+             * @brief Hop
+             *
+             * The description of a single hop of the sequence.
+             */
+            struct Hop
+            {
+                double omegaZero;   //!< Starting angular velocity in radians per sample.
+                double accel;       //!< Acceleration in radians per sample, per sample.
+                size_t dwell;       //!< The number of samples of the hop.
+            };
+
+            /**
+             * @brief Constructor
+             *
+             * @param pHops Array of hops, copied.
+             * @param numHops Number of hops.
+             * @param phaseMode The phase mode.
+             * @param phi Starting phase angle in radians.
+             *
+             * @throw Throws std::invalid_argument if there are no hops or if any hop has a dwell of zero.
+             */
+            ChirpHopSequenceGenerator( const Hop * pHops, size_t numHops,
+                                       PhaseMode phaseMode=PhaseMode::Continuous, double phi=0.0 );
+
+            /**
+             * @brief Destructor
+             */
+            ~ChirpHopSequenceGenerator();
+
+            ChirpHopSequenceGenerator( const ChirpHopSequenceGenerator & another ) = delete;
+            ChirpHopSequenceGenerator & operator=( const ChirpHopSequenceGenerator & another ) = delete;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' samples of the sequence into the user provided buffer, overwriting it.
+             * Subsequent invocations continue on in phase with those previous, across hop boundaries.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Restarts the sequence from sample zero.
+             */
+            void reset();
+
+            /**
+             * @brief Get Number of Hops
+             *
+             * @return Returns the number of hops in the table.
+             */
+            size_t getNumHops() const;
+
+            /**
+             * @brief Get Cycle Length
+             *
+             * @return Returns the number of samples of one cycle through the table, the sum of all dwells.
+             */
+            size_t getCycleLength() const;
+
+            /**
+             * @brief Get Hop Index
+             *
+             * @return Returns the index of the hop which the next sample delivered belongs to.
+             */
+            size_t getHopIndex() const;
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @return Returns the number of samples delivered since construction or reset.
+             */
+            size_t getSampleCount() const;
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_CHIRPHOPSEQUENCEGENERATOR_H
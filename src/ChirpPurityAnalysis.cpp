@@ -0,0 +1,139 @@
+/**
+ * @file ChirpPurityAnalysis.cpp
+ * @brief The implementation file for the Chirp Purity Analysis components.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "ChirpPurityAnalysis.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Wraps an angle difference, of magnitude no more than 2 pi, into [-pi, pi].
+    inline double wrapDelta( double delta )
+    {
+        constexpr double pi = 3.14159265358979323846;
+        if ( delta > pi ) return delta - 2.0 * pi;
+        if ( delta < -pi ) return delta + 2.0 * pi;
+        return delta;
+    }
+}
+
+RunningStatistics::RunningStatistics( double theOrigin )
+  : origin{ theOrigin }
+  , mean{}
+  , m2{}
+  , minValue{ std::numeric_limits< double >::max() }
+  , maxValue{ std::numeric_limits< double >::lowest() }
+  , count{}
+{
+}
+
+void RunningStatistics::merge( const RunningStatistics & another )
+{
+    if ( origin != another.origin )
+        throw std::invalid_argument( "RunningStatistics instances of differing origins cannot be merged" );
+    if ( !another.count ) return;
+    if ( !count )
+    {
+        *this = another;
+        return;
+    }
+
+    // The parallel form of Welford's algorithm (Chan et al.).
+    const auto n = count + another.count;
+    const auto delta = another.mean - mean;
+    const auto ratio = double( another.count ) / double( n );
+    mean += delta * ratio;
+    m2 += another.m2 + delta * delta * double( count ) * ratio;
+    count = n;
+    if ( another.minValue < minValue ) minValue = another.minValue;
+    if ( another.maxValue > maxValue ) maxValue = another.maxValue;
+}
+
+void RunningStatistics::reset()
+{
+    mean = 0.0;
+    m2 = 0.0;
+    minValue = std::numeric_limits< double >::max();
+    maxValue = std::numeric_limits< double >::lowest();
+    count = 0;
+}
+
+double RunningStatistics::getMean() const
+{
+    return count ? origin + mean : std::numeric_limits< double >::quiet_NaN();
+}
+
+double RunningStatistics::getVariance() const
+{
+    return count > 1 ? m2 / double( count - 1 ) : std::numeric_limits< double >::quiet_NaN();
+}
+
+double RunningStatistics::getMaxNegDev() const
+{
+    return count ? minValue - mean : std::numeric_limits< double >::quiet_NaN();
+}
+
+double RunningStatistics::getMaxPosDev() const
+{
+    return count ? maxValue - mean : std::numeric_limits< double >::quiet_NaN();
+}
+
+PhasePurityAnalyzer::PhasePurityAnalyzer( double expectedAccel )
+  : stats{ expectedAccel }
+  , prevPhase{}
+  , prevDelta{}
+  , historyCount{}
+{
+}
+
+void PhasePurityAnalyzer::addSamples( const FlyingPhasorElementType * pSamples, size_t numSamples )
+{
+    for ( size_t n = 0; numSamples != n; ++n )
+    {
+        const auto phase = std::arg( pSamples[n] );
+        if ( historyCount )
+        {
+            // The wrapped phase difference is the mean angular velocity (omegaBar) between two samples.
+            // Its difference is the angular acceleration.
+            const auto delta = wrapDelta( phase - prevPhase );
+            if ( 1 < historyCount )
+                stats.addSample( wrapDelta( delta - prevDelta ) );
+            else
+                ++historyCount;
+            prevDelta = delta;
+        }
+        else
+            ++historyCount;
+        prevPhase = phase;
+    }
+}
+
+void PhasePurityAnalyzer::restartStream()
+{
+    historyCount = 0;
+}
+
+void PhasePurityAnalyzer::reset()
+{
+    stats.reset();
+    historyCount = 0;
+}
+
+MagPurityAnalyzer::MagPurityAnalyzer()
+  : stats{ 1.0 }
+{
+}
+
+void MagPurityAnalyzer::addSamples( const FlyingPhasorElementType * pSamples, size_t numSamples )
+{
+    for ( size_t n = 0; numSamples != n; ++n )
+        stats.addSample( std::abs( pSamples[n] ) );
+}
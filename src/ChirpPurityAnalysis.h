@@ -0,0 +1,242 @@
+/**
+ * @file ChirpPurityAnalysis.h
+ * @brief The specification file for the Chirp Purity Analysis components.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_CHIRPPURITYANALYSIS_H
+#define REISER_RT_CHIRPPURITYANALYSIS_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Running Statistics
+         *
+         * Performs "running" (online) statistics accumulation with Welford's algorithm, which is much less prone
+         * to loss of precision due to catastrophic cancellation than accumulating sums of squares. Two instances
+         * may be merged with the parallel form of the algorithm (Chan et al.), so that disjoint ranges of a series
+         * may be accumulated independently, on separate threads for example, and combined afterwards.
+         *
+         * Values are accumulated relative to an origin, the value expected. Purity analysis looks at deviations
+         * many orders of magnitude smaller than the values themselves, and accumulating the deviations
+         * rather than the values preserves them in double precision without resorting to long double.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT RunningStatistics
+        {
+        public:
+            /**
+             * @brief Constructor
+             *
+             * @param origin The value which accumulation is relative to. Ideally, the value expected.
+             */
+            explicit RunningStatistics( double origin=0.0 );
+
+            /**
+             * @brief Add Sample Operation
+             *
+             * @param value The value to be accumulated.
+             */
+            inline void addSample( double value )
+            {
+                const double x = value - origin;
+                ++count;
+                const double delta = x - mean;
+                mean += delta / double( count );
+                m2 += delta * ( x - mean );
+                if ( x < minValue ) minValue = x;
+                if ( x > maxValue ) maxValue = x;
+            }
+
+            /**
+             * @brief Merge Operation
+             *
+             * Combines the statistics of another instance into this instance, as if all of its values
+             * had been added to this instance.
+             *
+             * @param another Another instance, with the same origin.
+             *
+             * @throw Throws std::invalid_argument if the origins differ.
+             */
+            void merge( const RunningStatistics & another );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Discards all accumulated values. The origin is retained.
+             */
+            void reset();
+
+            /**
+             * @brief Get Count
+             *
+             * @return Returns the number of values accumulated.
+             */
+            inline uint64_t getCount() const { return count; }
+
+            /**
+             * @brief Get Mean
+             *
+             * @return Returns the mean, or NaN if no values have been accumulated.
+             */
+            double getMean() const;
+
+            /**
+             * @brief Get Variance
+             *
+             * @return Returns the (unbiased) sample variance, or NaN if fewer than two values have been accumulated.
+             */
+            double getVariance() const;
+
+            /**
+             * @brief Get Maximum Negative Deviation
+             *
+             * @return Returns the minimum value less the mean, or NaN if no values have been accumulated.
+             */
+            double getMaxNegDev() const;
+
+            /**
+             * @brief Get Maximum Positive Deviation
+             *
+             * @return Returns the maximum value less the mean, or NaN if no values have been accumulated.
+             */
+            double getMaxPosDev() const;
+
+        private:
+            double origin;      //!< The value which accumulation is relative to.
+            double mean;        //!< The running mean, relative to the origin.
+            double m2;          //!< The running sum of squared deviations from the mean.
+            double minValue;    //!< The minimum value, relative to the origin.
+            double maxValue;    //!< The maximum value, relative to the origin.
+            uint64_t count;     //!< The number of values accumulated.
+        };
+
+        /**
+         * @brief Phase Purity Analyzer
+         *
+         * Measures the angular acceleration of a chirp sample series, sample by sample, as the second difference
+         * of sample phase (each difference wrapped into [-pi, pi]), and accumulates its statistics. Samples may be
+         * streamed in chunks of any size. The first two samples of a stream provide history only, and every
+         * subsequent sample yields one measurement.
+         *
+         * As each measurement depends only on its two preceding samples, disjoint ranges of a very long series may
+         * be analyzed on separate threads. Each range after the first begins with the last two samples of the range
+         * before it, as history, and the analyzers are merged afterwards. The result is that of a single stream.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT PhasePurityAnalyzer
+        {
+        public:
+            /**
+             * @brief Constructor
+             *
+             * @param expectedAccel The acceleration expected in radians per sample, per sample.
+             */
+            explicit PhasePurityAnalyzer( double expectedAccel=0.0 );
+
+            /**
+             * @brief Add Samples Operation
+             *
+             * Continues the current stream with more samples.
+             *
+             * @param pSamples The samples.
+             * @param numSamples The number of samples.
+             */
+            void addSamples( const FlyingPhasorElementType * pSamples, size_t numSamples );
+
+            /**
+             * @brief Restart Stream Operation
+             *
+             * Discards the history of the current stream, so that subsequent samples begin a new, disjoint stream.
+             * Accumulated statistics are retained.
+             */
+            void restartStream();
+
+            /**
+             * @brief Reset Operation
+             *
+             * Discards the history of the current stream and all accumulated statistics.
+             */
+            void reset();
+
+            /**
+             * @brief Merge Operation
+             *
+             * @param another Another analyzer, of the same expected acceleration, whose statistics are to be combined.
+             *
+             * @throw Throws std::invalid_argument if the expected accelerations differ.
+             */
+            inline void merge( const PhasePurityAnalyzer & another ) { stats.merge( another.stats ); }
+
+            /**
+             * @brief Get Statistics
+             *
+             * @return Returns the statistics of the measured acceleration.
+             */
+            inline const RunningStatistics & getStatistics() const { return stats; }
+
+        private:
+            RunningStatistics stats;    //!< Acceleration statistics.
+            double prevPhase;           //!< Phase of the previous sample.
+            double prevDelta;           //!< Wrapped phase difference between the previous two samples.
+            unsigned historyCount;      //!< The number of samples of history available, up to two.
+        };
+
+        /**
+         * @brief Magnitude Purity Analyzer
+         *
+         * Measures the magnitude of a sample series, relative to unity, and accumulates its statistics.
+         * Samples may be streamed in chunks of any size and analyzers of disjoint ranges merged.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT MagPurityAnalyzer
+        {
+        public:
+            /**
+             * @brief Default Constructor
+             */
+            MagPurityAnalyzer();
+
+            /**
+             * @brief Add Samples Operation
+             *
+             * @param pSamples The samples.
+             * @param numSamples The number of samples.
+             */
+            void addSamples( const FlyingPhasorElementType * pSamples, size_t numSamples );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Discards all accumulated statistics.
+             */
+            inline void reset() { stats.reset(); }
+
+            /**
+             * @brief Merge Operation
+             *
+             * @param another Another analyzer whose statistics are to be combined.
+             */
+            inline void merge( const MagPurityAnalyzer & another ) { stats.merge( another.stats ); }
+
+            /**
+             * @brief Get Statistics
+             *
+             * @return Returns the statistics of the measured magnitude.
+             */
+            inline const RunningStatistics & getStatistics() const { return stats; }
+
+        private:
+            RunningStatistics stats;    //!< Magnitude statistics.
+        };
+    }
+}
+
+#endif //REISER_RT_CHIRPPURITYANALYSIS_H
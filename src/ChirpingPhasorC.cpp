@@ -0,0 +1,209 @@
+/**
+ * @file ChirpingPhasorC.cpp
+ * @brief The implementation file for the C language interface of the Chirping Phasor Tone Generator.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "ChirpingPhasorC.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+/**
+ * @brief The object behind an opaque handle.
+ */
+struct ReiserRT_ChirpingPhasor_Generator
+{
+    ChirpingPhasorToneGenerator generator;  //!< The generator operated upon.
+};
+
+namespace
+{
+    // The number of generators processed per block by resetMany.
+    constexpr size_t batchBlockSize = 64;
+
+    // std::complex< double > is layout compatible with an array of two doubles (real, imaginary).
+    inline FlyingPhasorElementBufferTypePtr asElements( double * pSamples )
+    {
+        return reinterpret_cast< FlyingPhasorElementBufferTypePtr >( pSamples );
+    }
+
+    // Invokes an operation, translating any exception into a status code.
+    template< typename Operation >
+    inline int guarded( Operation && operation )
+    {
+        try
+        {
+            operation();
+            return ReiserRT_ChirpingPhasor_Ok;
+        }
+        catch ( const std::bad_alloc & )
+        {
+            return ReiserRT_ChirpingPhasor_OutOfMemory;
+        }
+        catch ( const std::invalid_argument & )
+        {
+            return ReiserRT_ChirpingPhasor_InvalidArgument;
+        }
+        catch ( ... )
+        {
+            return ReiserRT_ChirpingPhasor_Failure;
+        }
+    }
+
+    inline bool anyNull( const ReiserRT_ChirpingPhasor_Handle * pHandles, size_t numHandles )
+    {
+        for ( size_t i = 0; numHandles != i; ++i )
+            if ( !pHandles[i] ) return true;
+        return false;
+    }
+}
+
+const char * ReiserRT_ChirpingPhasor_statusString( int status )
+{
+    switch ( status )
+    {
+        case ReiserRT_ChirpingPhasor_Ok: return "Ok";
+        case ReiserRT_ChirpingPhasor_NullArgument: return "Null argument";
+        case ReiserRT_ChirpingPhasor_InvalidArgument: return "Invalid argument";
+        case ReiserRT_ChirpingPhasor_BufferTooSmall: return "Buffer too small";
+        case ReiserRT_ChirpingPhasor_OutOfMemory: return "Out of memory";
+        case ReiserRT_ChirpingPhasor_Failure: return "Failure";
+        default: return "Unknown status";
+    }
+}
+
+int ReiserRT_ChirpingPhasor_create( double accel, double omegaZero, double phi,
+                                    ReiserRT_ChirpingPhasor_Handle * pHandle )
+{
+    if ( !pHandle ) return ReiserRT_ChirpingPhasor_NullArgument;
+    *pHandle = nullptr;
+    return guarded( [&]() {
+        *pHandle = new ReiserRT_ChirpingPhasor_Generator{ ChirpingPhasorToneGenerator{ accel, omegaZero, phi } };
+    } );
+}
+
+void ReiserRT_ChirpingPhasor_destroy( ReiserRT_ChirpingPhasor_Handle handle )
+{
+    delete handle;
+}
+
+int ReiserRT_ChirpingPhasor_reset( ReiserRT_ChirpingPhasor_Handle handle, double accel, double omegaZero, double phi )
+{
+    if ( !handle ) return ReiserRT_ChirpingPhasor_NullArgument;
+    return guarded( [&]() { handle->generator.reset( accel, omegaZero, phi ); } );
+}
+
+int ReiserRT_ChirpingPhasor_modifyAccel( ReiserRT_ChirpingPhasor_Handle handle, double newAccel )
+{
+    if ( !handle ) return ReiserRT_ChirpingPhasor_NullArgument;
+    return guarded( [&]() { handle->generator.modifyAccel( newAccel ); } );
+}
+
+int ReiserRT_ChirpingPhasor_setResyncInterval( ReiserRT_ChirpingPhasor_Handle handle, uint64_t interval )
+{
+    if ( !handle ) return ReiserRT_ChirpingPhasor_NullArgument;
+    return guarded( [&]() { handle->generator.setResyncInterval( static_cast< size_t >( interval ) ); } );
+}
+
+int ReiserRT_ChirpingPhasor_getSamples( ReiserRT_ChirpingPhasor_Handle handle, double * pSamples, size_t numSamples )
+{
+    if ( !handle || ( !pSamples && numSamples ) ) return ReiserRT_ChirpingPhasor_NullArgument;
+    return guarded( [&]() { handle->generator.getSamples( asElements( pSamples ), numSamples ); } );
+}
+
+int ReiserRT_ChirpingPhasor_getSampleCount( ReiserRT_ChirpingPhasor_Handle handle, uint64_t * pCount )
+{
+    if ( !handle || !pCount ) return ReiserRT_ChirpingPhasor_NullArgument;
+    *pCount = handle->generator.getSampleCount();
+    return ReiserRT_ChirpingPhasor_Ok;
+}
+
+int ReiserRT_ChirpingPhasor_getOmegaBar( ReiserRT_ChirpingPhasor_Handle handle, double * pOmegaBar )
+{
+    if ( !handle || !pOmegaBar ) return ReiserRT_ChirpingPhasor_NullArgument;
+    *pOmegaBar = handle->generator.getOmegaBar();
+    return ReiserRT_ChirpingPhasor_Ok;
+}
+
+size_t ReiserRT_ChirpingPhasor_stateSize( void )
+{
+    return sizeof( ChirpingPhasorToneGenerator::StateSnapshot );
+}
+
+int ReiserRT_ChirpingPhasor_saveState( ReiserRT_ChirpingPhasor_Handle handle, void * pState, size_t stateSize )
+{
+    if ( !handle || !pState ) return ReiserRT_ChirpingPhasor_NullArgument;
+    if ( stateSize < sizeof( ChirpingPhasorToneGenerator::StateSnapshot ) )
+        return ReiserRT_ChirpingPhasor_BufferTooSmall;
+
+    // The snapshot is trivially copyable. Copying bytes frees the caller from any alignment requirement.
+    const auto state = handle->generator.saveState();
+    std::memcpy( pState, &state, sizeof( state ) );
+    return ReiserRT_ChirpingPhasor_Ok;
+}
+
+int ReiserRT_ChirpingPhasor_restoreState( ReiserRT_ChirpingPhasor_Handle handle, const void * pState, size_t stateSize )
+{
+    if ( !handle || !pState ) return ReiserRT_ChirpingPhasor_NullArgument;
+    if ( stateSize < sizeof( ChirpingPhasorToneGenerator::StateSnapshot ) )
+        return ReiserRT_ChirpingPhasor_BufferTooSmall;
+
+    ChirpingPhasorToneGenerator::StateSnapshot state;
+    std::memcpy( &state, pState, sizeof( state ) );
+    handle->generator.restoreState( state );
+    return ReiserRT_ChirpingPhasor_Ok;
+}
+
+int ReiserRT_ChirpingPhasor_resetMany( const ReiserRT_ChirpingPhasor_Handle * pHandles, const double * pAccel,
+                                       const double * pOmegaZero, const double * pPhi, size_t numGenerators )
+{
+    if ( !numGenerators ) return ReiserRT_ChirpingPhasor_Ok;
+    if ( !pHandles || !pAccel || !pOmegaZero || !pPhi || anyNull( pHandles, numGenerators ) )
+        return ReiserRT_ChirpingPhasor_NullArgument;
+
+    return guarded( [&]() {
+        ChirpingPhasorToneGenerator::StateSnapshot states[ batchBlockSize ];
+        for ( size_t i0 = 0; numGenerators > i0; i0 += batchBlockSize )
+        {
+            const auto count = numGenerators - i0 < batchBlockSize ? numGenerators - i0 : batchBlockSize;
+            ChirpingPhasorToneGenerator::makeInitialStates( pAccel + i0, pOmegaZero + i0, pPhi + i0, count, states );
+            for ( size_t i = 0; count != i; ++i )
+                pHandles[ i0 + i ]->generator.restoreInitialState( states[i] );
+        }
+    } );
+}
+
+int ReiserRT_ChirpingPhasor_getSamplesMany( const ReiserRT_ChirpingPhasor_Handle * pHandles, size_t numGenerators,
+                                            double * pSamples, size_t numSamples, size_t rowStride )
+{
+    if ( !numGenerators || !numSamples ) return ReiserRT_ChirpingPhasor_Ok;
+    if ( !pHandles || !pSamples || anyNull( pHandles, numGenerators ) ) return ReiserRT_ChirpingPhasor_NullArgument;
+    if ( rowStride < numSamples ) return ReiserRT_ChirpingPhasor_InvalidArgument;
+
+    return guarded( [&]() {
+        auto pRow = asElements( pSamples );
+        for ( size_t i = 0; numGenerators != i; ++i, pRow += rowStride )
+            pHandles[i]->generator.getSamples( pRow, numSamples );
+    } );
+}
+
+int ReiserRT_ChirpingPhasor_getSamplesChunked( ReiserRT_ChirpingPhasor_Handle handle, double * const * ppChunks,
+                                               const size_t * pChunkSizes, size_t numChunks )
+{
+    if ( !handle ) return ReiserRT_ChirpingPhasor_NullArgument;
+    if ( !numChunks ) return ReiserRT_ChirpingPhasor_Ok;
+    if ( !ppChunks || !pChunkSizes ) return ReiserRT_ChirpingPhasor_NullArgument;
+    for ( size_t i = 0; numChunks != i; ++i )
+        if ( !ppChunks[i] && pChunkSizes[i] ) return ReiserRT_ChirpingPhasor_NullArgument;
+
+    return guarded( [&]() {
+        for ( size_t i = 0; numChunks != i; ++i )
+            handle->generator.getSamples( asElements( ppChunks[i] ), pChunkSizes[i] );
+    } );
+}
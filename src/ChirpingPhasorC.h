@@ -0,0 +1,227 @@
+/**
+ * @file ChirpingPhasorC.h
+ * @brief The specification file for the C language interface of the Chirping Phasor Tone Generator.
+ *
+ * This interface serves C clients and foreign function interfaces (Python ctypes/cffi, Julia ccall and the like).
+ * Generators are referred to by opaque handles. Every operation returning an int returns a status code
+ * from the ReiserRT_ChirpingPhasor_Status enumeration. No C++ exception ever crosses this interface.
+ *
+ * Complex samples are written as interleaved (real, imaginary) pairs of doubles, the layout of C99
+ * `double complex`, std::complex<double> and a NumPy complex128 array. Samples are written directly into
+ * caller owned buffers without any intermediate copy.
+ *
+ * As with the C++ interface, a handle must not be operated upon by multiple threads concurrently.
+ * Distinct handles may be operated upon concurrently.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_CHIRPINGPHASORC_H
+#define REISER_RT_CHIRPINGPHASORC_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque Generator Handle
+ */
+typedef struct ReiserRT_ChirpingPhasor_Generator * ReiserRT_ChirpingPhasor_Handle;
+
+/**
+ * @brief Status Codes
+ */
+typedef enum
+{
+    ReiserRT_ChirpingPhasor_Ok = 0,             /*!< The operation succeeded. */
+    ReiserRT_ChirpingPhasor_NullArgument = 1,   /*!< A required handle or pointer argument was null. */
+    ReiserRT_ChirpingPhasor_InvalidArgument = 2,/*!< An argument value was out of range. */
+    ReiserRT_ChirpingPhasor_BufferTooSmall = 3, /*!< A caller provided buffer was too small. */
+    ReiserRT_ChirpingPhasor_OutOfMemory = 4,    /*!< Memory could not be allocated. */
+    ReiserRT_ChirpingPhasor_Failure = 5         /*!< Any other failure. */
+} ReiserRT_ChirpingPhasor_Status;
+
+/**
+ * @brief Status String
+ *
+ * @param status A status code.
+ * @return Returns a static, human readable description of the status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT const char * ReiserRT_ChirpingPhasor_statusString( int status );
+
+/**
+ * @brief Create a Generator
+ *
+ * @param accel Acceleration in radians per sample, per sample.
+ * @param omegaZero Starting angular velocity in radians per sample.
+ * @param phi Starting phase angle in radians.
+ * @param pHandle Receives the handle of the new generator, to be released with ReiserRT_ChirpingPhasor_destroy.
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_create( double accel, double omegaZero, double phi,
+                                                                   ReiserRT_ChirpingPhasor_Handle * pHandle );
+
+/**
+ * @brief Destroy a Generator
+ *
+ * @param handle A handle obtained from ReiserRT_ChirpingPhasor_create. A null handle is ignored.
+ */
+ReiserRT_ChirpingPhasor_EXPORT void ReiserRT_ChirpingPhasor_destroy( ReiserRT_ChirpingPhasor_Handle handle );
+
+/**
+ * @brief Reset a Generator
+ *
+ * Equivalent to the C++ reset operation. The resync interval is preserved.
+ *
+ * @param handle The generator handle.
+ * @param accel Acceleration in radians per sample, per sample.
+ * @param omegaZero Starting angular velocity in radians per sample.
+ * @param phi Starting phase angle in radians.
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_reset( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                  double accel, double omegaZero, double phi );
+
+/**
+ * @brief Modify the Acceleration of a Generator
+ *
+ * @param handle The generator handle.
+ * @param newAccel New acceleration in radians per sample, per sample.
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_modifyAccel( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                        double newAccel );
+
+/**
+ * @brief Set the Resync Interval of a Generator
+ *
+ * @param handle The generator handle.
+ * @param interval Samples between exact resynchronizations, zero to disable.
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_setResyncInterval( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                              uint64_t interval );
+
+/**
+ * @brief Get Samples
+ *
+ * @param handle The generator handle.
+ * @param pSamples Buffer of at least 2 * numSamples doubles, receiving interleaved (real, imaginary) samples.
+ * @param numSamples The number of complex samples to generate.
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_getSamples( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                       double * pSamples, size_t numSamples );
+
+/**
+ * @brief Get Sample Count
+ *
+ * @param handle The generator handle.
+ * @param pCount Receives the number of samples generated since construction or reset.
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_getSampleCount( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                           uint64_t * pCount );
+
+/**
+ * @brief Get Omega Bar
+ *
+ * @param handle The generator handle.
+ * @param pOmegaBar Receives the mean angular velocity between the next two samples in radians per sample.
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_getOmegaBar( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                        double * pOmegaBar );
+
+/**
+ * @brief Get State Size
+ *
+ * @return Returns the number of bytes of a saved state. States are only valid with the library version saving them.
+ */
+ReiserRT_ChirpingPhasor_EXPORT size_t ReiserRT_ChirpingPhasor_stateSize( void );
+
+/**
+ * @brief Save State
+ *
+ * @param handle The generator handle.
+ * @param pState Buffer receiving the state, of any alignment.
+ * @param stateSize The size of the buffer in bytes, at least ReiserRT_ChirpingPhasor_stateSize().
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_saveState( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                      void * pState, size_t stateSize );
+
+/**
+ * @brief Restore State
+ *
+ * @param handle The generator handle.
+ * @param pState Buffer holding a state previously saved, of any alignment.
+ * @param stateSize The size of the buffer in bytes, at least ReiserRT_ChirpingPhasor_stateSize().
+ * @return Returns a status code.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_restoreState( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                         const void * pState, size_t stateSize );
+
+/**
+ * @brief Reset Many Generators
+ *
+ * Resets many generators from a structure of arrays parameter table, with the trigonometry for the whole table
+ * computed by a vectorized batch sine and cosine. Equivalent to invoking ReiserRT_ChirpingPhasor_reset for each,
+ * except that the starting phasors may differ from those of individual resets by an ulp.
+ *
+ * @param pHandles Array of numGenerators generator handles.
+ * @param pAccel Array of accelerations in radians per sample, per sample.
+ * @param pOmegaZero Array of starting angular velocities in radians per sample.
+ * @param pPhi Array of starting phase angles in radians.
+ * @param numGenerators The number of entries in each of the arrays.
+ * @return Returns a status code. No generator is reset if any handle is null.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_resetMany( const ReiserRT_ChirpingPhasor_Handle * pHandles,
+                                                                      const double * pAccel, const double * pOmegaZero,
+                                                                      const double * pPhi, size_t numGenerators );
+
+/**
+ * @brief Get Samples from Many Generators
+ *
+ * Fills one row of a two dimensional buffer per generator, a C ordered NumPy array of shape
+ * (numGenerators, rowStride) for example.
+ *
+ * @param pHandles Array of numGenerators generator handles.
+ * @param numGenerators The number of generators.
+ * @param pSamples Buffer of interleaved (real, imaginary) samples. Row i begins at complex sample i * rowStride.
+ * @param numSamples The number of complex samples to generate from each generator.
+ * @param rowStride The distance between rows in complex samples, at least numSamples.
+ * @return Returns a status code. No samples are generated if any handle is null.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_getSamplesMany( const ReiserRT_ChirpingPhasor_Handle * pHandles,
+                                                                           size_t numGenerators, double * pSamples,
+                                                                           size_t numSamples, size_t rowStride );
+
+/**
+ * @brief Get Samples into Many Chunks
+ *
+ * Fills many caller owned buffers from a single generator, in order, as if ReiserRT_ChirpingPhasor_getSamples
+ * were invoked for each.
+ *
+ * @param handle The generator handle.
+ * @param ppChunks Array of numChunks buffers of interleaved (real, imaginary) samples.
+ * @param pChunkSizes Array of numChunks sizes in complex samples.
+ * @param numChunks The number of chunks.
+ * @return Returns a status code. No samples are generated if any chunk with a nonzero size is null.
+ */
+ReiserRT_ChirpingPhasor_EXPORT int ReiserRT_ChirpingPhasor_getSamplesChunked( ReiserRT_ChirpingPhasor_Handle handle,
+                                                                              double * const * ppChunks,
+                                                                              const size_t * pChunkSizes,
+                                                                              size_t numChunks );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REISER_RT_CHIRPINGPHASORC_H */
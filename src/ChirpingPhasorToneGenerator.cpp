@@ -6,14 +6,191 @@
  */
 
 #include "ChirpingPhasorToneGenerator.h"
+#include "ComplexGaussianNoiseSource.h"
+#include "AmplitudeTaper.h"
+#include "BatchSinCos.h"
+
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 
 using namespace ReiserRT::Signal;
 
+// Our snapshot relies on copying our `rate` attribute as raw bytes. Ensure it is legitimate to do so.
+static_assert( std::is_trivially_copyable< FlyingPhasorToneGenerator >::value,
+               "FlyingPhasorToneGenerator must be trivially copyable" );
+static_assert( std::is_trivially_copyable< ChirpingPhasorToneGenerator::StateSnapshot >::value &&
+               std::is_standard_layout< ChirpingPhasorToneGenerator::StateSnapshot >::value,
+               "ChirpingPhasorToneGenerator::StateSnapshot must be a POD" );
+
+constexpr size_t ChirpingPhasorToneGenerator::maxSteppedGap;
+
+namespace
+{
+    using CompensatedAngle = ChirpingPhasorToneGenerator::CompensatedAngle;
+
+    // Two pi as an unevaluated sum of two doubles.
+    constexpr CompensatedAngle twoPi{ 6.283185307179586232, 2.4492935982947064e-16 };
+
+    // Error free transformation of a sum (Knuth's TwoSum).
+    inline CompensatedAngle twoSum( double a, double b )
+    {
+        const auto s = a + b;
+        const auto bb = s - a;
+        return { s, ( a - ( s - bb ) ) + ( b - bb ) };
+    }
+
+    // Error free transformation of a sum where |a| >= |b| (Dekker's FastTwoSum).
+    inline CompensatedAngle quickTwoSum( double a, double b )
+    {
+        const auto s = a + b;
+        return { s, b - ( s - a ) };
+    }
+
+    inline CompensatedAngle add( const CompensatedAngle & x, const CompensatedAngle & y )
+    {
+        auto s = twoSum( x.hi, y.hi );
+        const auto t = twoSum( x.lo, y.lo );
+        s = quickTwoSum( s.hi, s.lo + t.hi );
+        return quickTwoSum( s.hi, s.lo + t.lo );
+    }
+
+    inline CompensatedAngle mul( const CompensatedAngle & x, double y )
+    {
+        const auto p = x.hi * y;
+        return quickTwoSum( p, std::fma( x.hi, y, -p ) + x.lo * y );
+    }
+
+    // Reduces an angle to approximately the interval [-pi, pi].
+    inline CompensatedAngle wrapAngle( const CompensatedAngle & angle )
+    {
+        const auto k = std::nearbyint( angle.hi / twoPi.hi );
+        return 0.0 == k ? angle : add( angle, mul( twoPi, -k ) );
+    }
+
+    inline CompensatedAngle wrapAngle( double angle ) { return wrapAngle( CompensatedAngle{ angle, 0.0 } ); }
+
+    /**
+     * @brief Seeds the raw bytes of FlyingPhasorToneGenerator instances from precomputed cosines and sines.
+     *
+     * The attributes of a FlyingPhasorToneGenerator are private to its library. Upon construction, we probe
+     * where an instance holds its rate and phasor (as complex values) and, optionally, its construction
+     * parameters. The probe is verified by seeding the bytes of an instance with other parameters and comparing
+     * them to those of an instance constructed with those parameters. Should the layout not be established,
+     * instances are simply constructed, invoking their own trigonometry.
+     */
+    class FlyingPhasorSeeder
+    {
+    public:
+        FlyingPhasorSeeder()
+        {
+            constexpr double radiansPerSample = 0.3;
+            constexpr double phi = -0.7;
+            probe( radiansPerSample, phi, blank );
+            rateOffset = find( blank, std::cos( radiansPerSample ), std::sin( radiansPerSample ) );
+            phasorOffset = find( blank, std::cos( phi ), std::sin( phi ) );
+            radiansPerSampleOffset = find( blank, radiansPerSample );
+            phiOffset = find( blank, phi );
+            if ( notFound == rateOffset || notFound == phasorOffset ) return;
+
+            constexpr double otherRadiansPerSample = 0.11;
+            constexpr double otherPhi = 2.5;
+            unsigned char expected[ sizeof( FlyingPhasorToneGenerator ) ];
+            unsigned char seeded[ sizeof( FlyingPhasorToneGenerator ) ];
+            probe( otherRadiansPerSample, otherPhi, expected );
+            layoutKnown = true;
+            seed( seeded, otherRadiansPerSample, otherPhi, std::cos( otherRadiansPerSample ),
+                  std::sin( otherRadiansPerSample ), std::cos( otherPhi ), std::sin( otherPhi ) );
+            layoutKnown = 0 == std::memcmp( seeded, expected, sizeof( seeded ) );
+        }
+
+        // Writes the bytes of an instance as if constructed with `radiansPerSample` and `phi`,
+        // given their cosines and sines.
+        void seed( unsigned char * pBytes, double radiansPerSample, double phi,
+                   double cosRadiansPerSample, double sinRadiansPerSample, double cosPhi, double sinPhi ) const
+        {
+            if ( !layoutKnown )
+            {
+                const FlyingPhasorToneGenerator generator{ radiansPerSample, phi };
+                std::memcpy( pBytes, &generator, sizeof( generator ) );
+                return;
+            }
+
+            std::memcpy( pBytes, blank, sizeof( blank ) );
+            put( pBytes, rateOffset, cosRadiansPerSample );
+            put( pBytes, rateOffset + sizeof( double ), sinRadiansPerSample );
+            put( pBytes, phasorOffset, cosPhi );
+            put( pBytes, phasorOffset + sizeof( double ), sinPhi );
+            put( pBytes, radiansPerSampleOffset, radiansPerSample );
+            put( pBytes, phiOffset, phi );
+        }
+
+    private:
+        static constexpr size_t notFound = size_t( -1 );
+
+        static void probe( double radiansPerSample, double phi, unsigned char * pBytes )
+        {
+            // Constructed over zeroed storage so that any padding compares equal.
+            alignas( FlyingPhasorToneGenerator ) unsigned char storage[ sizeof( FlyingPhasorToneGenerator ) ] = {};
+            auto pGenerator = new ( storage ) FlyingPhasorToneGenerator{ radiansPerSample, phi };
+            std::memcpy( pBytes, storage, sizeof( storage ) );
+            pGenerator->~FlyingPhasorToneGenerator();
+        }
+
+        // Finds the unique offset of a sequence of one or two doubles, or returns notFound.
+        static size_t find( const unsigned char * pBytes, double first, double second )
+        {
+            const double values[] = { first, second };
+            return find( pBytes, values, sizeof( values ) );
+        }
+
+        static size_t find( const unsigned char * pBytes, double value )
+        {
+            return find( pBytes, &value, sizeof( value ) );
+        }
+
+        static size_t find( const unsigned char * pBytes, const double * pValues, size_t numBytes )
+        {
+            size_t offset = notFound;
+            for ( size_t i = 0; sizeof( FlyingPhasorToneGenerator ) >= i + numBytes; i += alignof( double ) )
+            {
+                if ( 0 != std::memcmp( pBytes + i, pValues, numBytes ) ) continue;
+                if ( notFound != offset ) return notFound;
+                offset = i;
+            }
+            return offset;
+        }
+
+        static void put( unsigned char * pBytes, size_t offset, double value )
+        {
+            if ( notFound != offset ) std::memcpy( pBytes + offset, &value, sizeof( value ) );
+        }
+
+        unsigned char blank[ sizeof( FlyingPhasorToneGenerator ) ]{};   //!< A probe instance, seeded over.
+        size_t rateOffset{ notFound };                                  //!< Offset of the rate phasor.
+        size_t phasorOffset{ notFound };                                //!< Offset of the phasor.
+        size_t radiansPerSampleOffset{ notFound };                      //!< Offset of radians per sample, if held.
+        size_t phiOffset{ notFound };                                   //!< Offset of phi, if held.
+        bool layoutKnown{};                                             //!< Whether seeding is established.
+    };
+
+    constexpr size_t FlyingPhasorSeeder::notFound;
+}
+
 ChirpingPhasorToneGenerator::ChirpingPhasorToneGenerator( double accel, double omegaZero, double phi )
   : accelOver2{ accel / 2.0 }
   , rate{ accel, omegaZero + accelOver2 }
   , phasor{ std::polar(1.0, phi ) }
   , sampleCounter{}
+  , trackTheta{ wrapAngle( phi ) }
+  , trackOmega{ wrapAngle( omegaZero ) }
+  , trackThetaUnwrapped{ phi, 0.0 }
+  , trackOmegaUnwrapped{ omegaZero, 0.0 }
+  , trackSample{}
+  , lastResyncSample{}
+  , resyncInterval{}
 {
     ///@see ChirpingPhasorToneGenerator::reset operation for an discussion on our initialization steps.
 }
@@ -46,22 +223,334 @@ void ChirpingPhasorToneGenerator::reset( double accel, double omegaZero, double
 
     // Sample counter starts at zero.
     sampleCounter = 0;
+
+    // Our closed form track starts at sample zero with the phase and angular velocity given.
+    // The resync interval is a mode of operation and is intentionally left alone.
+    trackTheta = wrapAngle( phi );
+    trackOmega = wrapAngle( omegaZero );
+    trackThetaUnwrapped = CompensatedAngle{ phi, 0.0 };
+    trackOmegaUnwrapped = CompensatedAngle{ omegaZero, 0.0 };
+    trackSample = 0;
+    lastResyncSample = 0;
 }
 
 void ChirpingPhasorToneGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
 {
-    for ( size_t i = 0; numSamples != i; ++i )
+    generate( numSamples, [&pElementBuffer]( const FlyingPhasorElementType & sample ) { *pElementBuffer++ = sample; } );
+}
+
+void ChirpingPhasorToneGenerator::getSamples( FlyingPhasorElementBufferTypePtr pFirst, size_t numFirst,
+                                              FlyingPhasorElementBufferTypePtr pSecond, size_t numSecond )
+{
+    // The recursion state simply carries over from one span to the next.
+    getSamples( pFirst, numFirst );
+    getSamples( pSecond, numSecond );
+}
+
+void ChirpingPhasorToneGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                              double * pOmega, double * pTheta )
+{
+    // Evaluate the tracks relative to the unwrapped phase and angular velocity at our first sample.
+    // Per sample, the closed form is evaluated directly rather than accumulated, so that no error builds up.
+    if ( pOmega || pTheta )
+    {
+        CompensatedAngle theta0, omega0;
+        unwrappedTrack( theta0, omega0 );
+        const auto accel = 2.0 * accelOver2;
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            const auto m = static_cast< double >( i );
+            if ( pOmega ) pOmega[i] = omega0.hi + ( accel * m + omega0.lo );
+            if ( pTheta ) pTheta[i] = theta0.hi + ( ( omega0.hi + accelOver2 * m ) * m + ( theta0.lo + omega0.lo * m ) );
+        }
+    }
+
+    if ( pElementBuffer )
+        getSamples( pElementBuffer, numSamples );
+    else
+        generate( numSamples, []( const FlyingPhasorElementType & ) {} );
+}
+
+void ChirpingPhasorToneGenerator::getRealSamples( double * pBuffer, size_t numSamples )
+{
+    generate( numSamples, [&pBuffer]( const FlyingPhasorElementType & sample ) { *pBuffer++ = sample.real(); } );
+}
+
+void ChirpingPhasorToneGenerator::getRealSamples( float * pBuffer, size_t numSamples )
+{
+    generate( numSamples, [&pBuffer]( const FlyingPhasorElementType & sample ) {
+        *pBuffer++ = static_cast< float >( sample.real() );
+    } );
+}
+
+void ChirpingPhasorToneGenerator::getImagSamples( double * pBuffer, size_t numSamples )
+{
+    generate( numSamples, [&pBuffer]( const FlyingPhasorElementType & sample ) { *pBuffer++ = sample.imag(); } );
+}
+
+void ChirpingPhasorToneGenerator::getImagSamples( float * pBuffer, size_t numSamples )
+{
+    generate( numSamples, [&pBuffer]( const FlyingPhasorElementType & sample ) {
+        *pBuffer++ = static_cast< float >( sample.imag() );
+    } );
+}
+
+void ChirpingPhasorToneGenerator::getSamplesWithNoise( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                       size_t numSamples, ComplexGaussianNoiseSource & noiseSource )
+{
+    // Generate a block, then add noise to it while it remains in cache.
+    constexpr size_t blockSize = ComplexGaussianNoiseSource::blockSize;
+    while ( numSamples )
+    {
+        const auto count = numSamples < blockSize ? numSamples : blockSize;
+        getSamples( pElementBuffer, count );
+        noiseSource.addSamples( pElementBuffer, count );
+        pElementBuffer += count;
+        numSamples -= count;
+    }
+}
+
+void ChirpingPhasorToneGenerator::getSamplesTapered( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                     size_t numSamples, const AmplitudeTaper & taper,
+                                                     size_t taperOffset )
+{
+    const auto pSegments = taper.getSegments();
+    const auto numSegments = taper.getNumSegments();
+    const auto pTerms = taper.getTerms();
+
+    auto n = taperOffset;
+    size_t segmentIndex = 0;
+    while ( numSamples )
+    {
+        // Find the segment holding taper sample n. Segments are ordered and contiguous.
+        while ( numSegments != segmentIndex && pSegments[ segmentIndex ].end <= n ) ++segmentIndex;
+        if ( numSegments == segmentIndex )
+        {
+            // Beyond the taper. We must still maintain our state.
+            generate( numSamples, [&pElementBuffer]( const FlyingPhasorElementType & ) {
+                *pElementBuffer++ = FlyingPhasorElementType{};
+            } );
+            return;
+        }
+
+        const auto & segment = pSegments[ segmentIndex ];
+        const auto count = numSamples < segment.end - n ? numSamples : segment.end - n;
+        const auto offset = segment.offset;
+        const auto numTerms = segment.numTerms;
+        if ( 0 == numTerms )
+        {
+            // Constant weight, flat if one.
+            if ( 1.0 == offset )
+            {
+                getSamples( pElementBuffer, count );
+                pElementBuffer += count;
+            }
+            else
+                generate( count, [&pElementBuffer, offset]( const FlyingPhasorElementType & sample ) {
+                    *pElementBuffer++ = sample * offset;
+                } );
+        }
+        else
+        {
+            // Each cosine term is the real part of a phasor seeded at taper sample n and rotated by its rate.
+            double amplitude[ AmplitudeTaper::maxTerms ];
+            double re[ AmplitudeTaper::maxTerms ];
+            double im[ AmplitudeTaper::maxTerms ];
+            double rateRe[ AmplitudeTaper::maxTerms ];
+            double rateIm[ AmplitudeTaper::maxTerms ];
+            for ( size_t k = 0; numTerms != k; ++k )
+            {
+                const auto & term = pTerms[ segment.firstTerm + k ];
+                amplitude[k] = term.amplitude;
+                const auto angle = std::remainder( term.omega * static_cast< double >( n ) + term.phase, 2.0 * M_PI );
+                re[k] = std::cos( angle );
+                im[k] = std::sin( angle );
+                rateRe[k] = std::cos( term.omega );
+                rateIm[k] = std::sin( term.omega );
+            }
+
+            size_t i = 0;
+            generate( count, [&]( const FlyingPhasorElementType & sample ) {
+                auto w = offset;
+                for ( size_t k = 0; numTerms != k; ++k )
+                {
+                    w += amplitude[k] * re[k];
+                    const auto r = re[k] * rateRe[k] - im[k] * rateIm[k];
+                    im[k] = re[k] * rateIm[k] + im[k] * rateRe[k];
+                    re[k] = r;
+                }
+                *pElementBuffer++ = sample * w;
+
+                // Re-normalize every other sample as our normalize operation does.
+                if ( ( i++ & 0x1 ) == 0x1 )
+                {
+                    for ( size_t k = 0; numTerms != k; ++k )
+                    {
+                        const auto d = 1.0 - ( re[k] * re[k] + im[k] * im[k] - 1.0 ) / 2.0;
+                        re[k] *= d;
+                        im[k] *= d;
+                    }
+                }
+            } );
+        }
+
+        numSamples -= count;
+        n += count;
+    }
+}
+
+void ChirpingPhasorToneGenerator::getSamplesStrided( FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                     size_t numSamples, size_t stride )
+{
+    if ( 0 == stride )
+        throw std::invalid_argument{ "ChirpingPhasorToneGenerator::getSamplesStrided stride must be non-zero" };
+
+    const auto accel = 2.0 * accelOver2;
+    const auto strideD = static_cast< double >( stride );
+    const auto strideAccel = accel * strideD * strideD;
+    while ( numSamples )
+    {
+        // Work up to the next resync point (if enabled), at least one stride, or the entire request otherwise.
+        auto count = numSamples;
+        if ( resyncInterval )
+        {
+            const auto strides = samplesUntilResync() / stride;
+            if ( strides < count ) count = strides ? strides : 1;
+        }
+
+        // Our current angular velocity, omegaN, is our omegaBar less `accelOver2`. The stride rate is
+        // seeded just as our `rate` attribute is in the reset operation, with accel * M^2 and omegaN * M.
+        const auto omegaN = getOmegaBar() - accelOver2;
+        FlyingPhasorToneGenerator strideRate{ strideAccel, omegaN * strideD + strideAccel / 2.0 };
+
+        for ( size_t i = 0; count != i; ++i )
+        {
+            *pElementBuffer++ = phasor;
+            phasor *= strideRate.getSample();
+
+            // Re-normalize every other sample, as the normalize operation does.
+            if ( i & 0x1 )
+                phasor *= 1.0 - ( phasor.real()*phasor.real() + phasor.imag()*phasor.imag() - 1.0 ) / 2.0;
+        }
+        numSamples -= count;
+
+        // Our `phasor` now holds the sample, count * M, samples later. Re-seed our `rate` attribute
+        // with the angular velocity there and account for the samples skipped.
+        const auto advanced = count * stride;
+        rate.reset( accel, omegaN + accel * static_cast< double >( advanced ) + accelOver2 );
+        sampleCounter += advanced;
+
+        if ( resyncInterval && sampleCounter - lastResyncSample >= resyncInterval ) resync();
+    }
+}
+
+void ChirpingPhasorToneGenerator::evaluateAt( const uint64_t * pOffsets, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                              size_t numSamples ) const
+{
+    for ( size_t i = 1; numSamples > i; ++i )
+        if ( pOffsets[i] < pOffsets[ i - 1 ] )
+            throw std::invalid_argument{ "ChirpingPhasorToneGenerator::evaluateAt offsets must be sorted" };
+
+    // Our private copy of the recursion, starting from the machine's next sample. The copy's `rate`
+    // is advanced by a plain phasor, as the inner workings of our `rate` attribute are not accessible.
+    const auto rateRate = std::polar( 1.0, 2.0 * accelOver2 );
+    auto p = phasor;
+    auto r = rate.peekNextSample();
+    uint64_t position = 0;
+    size_t steps = 0;
+
+    // Offsets are relative to the next sample, which is this far beyond our closed form track.
+    const auto trackOffset = static_cast< double >( sampleCounter - trackSample );
+
+    // Work through the offsets in blocks. A first pass over a block decides where re-seeds occur and gathers
+    // their angles, so that the batch sine and cosine computes all of the block's re-seeds in two calls.
+    constexpr size_t blockSize = 64;
+    double thetas[ blockSize ];
+    double omegaBars[ blockSize ];
+    double cosTheta[ blockSize ];
+    double sinTheta[ blockSize ];
+    double cosOmegaBar[ blockSize ];
+    double sinOmegaBar[ blockSize ];
+
+    for ( size_t i0 = 0; numSamples > i0; i0 += blockSize )
     {
-        // We always start with the current phasor to nail the very first sample (s0)
-        // and advance (rotate) afterward.
-        *pElementBuffer++ = phasor;
+        const auto count = numSamples - i0 < blockSize ? numSamples - i0 : blockSize;
+        const auto pBlockOffsets = pOffsets + i0;
+
+        // The re-seeds of this block. Our `rate` is re-seeded just as in the reset operation.
+        size_t numReseeds = 0;
+        auto stepPosition = position;
+        for ( size_t i = 0; count != i; ++i )
+        {
+            const auto offset = pBlockOffsets[i];
+            if ( maxSteppedGap < offset - stepPosition )
+            {
+                CompensatedAngle theta, omega;
+                wrappedTrack( trackOffset + static_cast< double >( offset ), theta, omega );
+                thetas[ numReseeds ] = theta.hi;
+                omegaBars[ numReseeds++ ] = omega.hi + accelOver2;
+            }
+            stepPosition = offset;
+        }
 
-        // Now advance (rotate) the phasor by our "dynamic" rate (complex multiply).
-        phasor *= rate.getSample();
+        batchSinCos( thetas, cosTheta, sinTheta, numReseeds );
+        batchSinCos( omegaBars, cosOmegaBar, sinOmegaBar, numReseeds );
 
-        // Perform normalization work. This only actually normalized ever other invocation.
-        // We invoke it to maintain that part of the state machine.
-        normalize();
+        // Deliver the block, stepping across small gaps and re-seeding across large ones, as decided above.
+        size_t k = 0;
+        for ( size_t i = 0; count != i; ++i )
+        {
+            const auto offset = pBlockOffsets[i];
+            if ( maxSteppedGap < offset - position )
+            {
+                p = FlyingPhasorElementType{ cosTheta[k], sinTheta[k] };
+                r = FlyingPhasorElementType{ cosOmegaBar[k], sinOmegaBar[k] };
+                ++k;
+                position = offset;
+                steps = 0;
+            }
+            for ( ; offset != position; ++position )
+            {
+                p *= r;
+                r *= rateRate;
+
+                // Re-normalize every other step, as the normalize operation does.
+                if ( steps++ & 0x1 )
+                {
+                    p *= 1.0 - ( p.real()*p.real() + p.imag()*p.imag() - 1.0 ) / 2.0;
+                    r *= 1.0 - ( r.real()*r.real() + r.imag()*r.imag() - 1.0 ) / 2.0;
+                }
+            }
+            pElementBuffer[ i0 + i ] = p;
+        }
+    }
+}
+
+void ChirpingPhasorToneGenerator::evaluateAt( const double * pTimes, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                              size_t numSamples ) const
+{
+    const auto trackOffset = static_cast< double >( sampleCounter - trackSample );
+
+    // Every sample is a re-seed here. The wrapped angles of a block are gathered for the batch sine and cosine.
+    constexpr size_t blockSize = 64;
+    double thetas[ blockSize ];
+    double cosines[ blockSize ];
+    double sines[ blockSize ];
+
+    for ( size_t i0 = 0; numSamples > i0; i0 += blockSize )
+    {
+        const auto count = numSamples - i0 < blockSize ? numSamples - i0 : blockSize;
+        for ( size_t i = 0; count != i; ++i )
+        {
+            CompensatedAngle theta, omega;
+            wrappedTrack( trackOffset + pTimes[ i0 + i ], theta, omega );
+            thetas[i] = theta.hi;
+        }
+
+        batchSinCos( thetas, cosines, sines, count );
+        const auto pBlock = pElementBuffer + i0;
+        for ( size_t i = 0; count != i; ++i )
+            pBlock[i] = FlyingPhasorElementType{ cosines[i], sines[i] };
     }
 }
 
@@ -78,11 +567,17 @@ FlyingPhasorElementType ChirpingPhasorToneGenerator::getSample()
     // We invoke it to maintain that part of the state machine.
     normalize();
 
+    // Resync if enabled and due.
+    if ( 0 == samplesUntilResync() ) resync();
+
     return retValue;
 }
 
 void ChirpingPhasorToneGenerator::modifyAccel( double newAccel )
 {
+    // Bring our closed form track up to date at the current acceleration before it changes.
+    advanceTrack();
+
     // Capture omegaN value of next sample in the pipeline at current acceleration.
     // Value omegaN is our current omegaBar value less current `accelOver2`.
     const auto omegaN = getOmegaBar() - accelOver2;
@@ -92,3 +587,144 @@ void ChirpingPhasorToneGenerator::modifyAccel( double newAccel )
     ///of the resetting of the `rate` attribute.
     rate.reset( newAccel, omegaN + ( accelOver2 = newAccel / 2.0 ) );
 }
+
+void ChirpingPhasorToneGenerator::setResyncInterval( size_t interval )
+{
+    // The interval counts from this point forward.
+    lastResyncSample = sampleCounter;
+    resyncInterval = interval;
+}
+
+void ChirpingPhasorToneGenerator::advanceTrack()
+{
+    CompensatedAngle theta, omega;
+    wrappedTrack( static_cast< double >( sampleCounter - trackSample ), theta, omega );
+    trackTheta = theta;
+    trackOmega = omega;
+    unwrappedTrack( trackThetaUnwrapped, trackOmegaUnwrapped );
+    trackSample = sampleCounter;
+}
+
+void ChirpingPhasorToneGenerator::wrappedTrack( double m, CompensatedAngle & theta, CompensatedAngle & omega ) const
+{
+    // The phase at sample n + m is, theta(n) + omega(n) * m + accelOver2 * m^2, and the angular
+    // velocity is, omega(n) + accel * m. Each term is reduced individually so that we never
+    // accumulate a large angle which would squander our compensated precision.
+    const CompensatedAngle halfAccel{ accelOver2, 0.0 };
+    const auto thetaInc = add( wrapAngle( mul( trackOmega, m ) ), wrapAngle( mul( mul( halfAccel, m ), m ) ) );
+    theta = wrapAngle( add( trackTheta, thetaInc ) );
+    omega = wrapAngle( add( trackOmega, wrapAngle( mul( halfAccel, 2.0 * m ) ) ) );
+}
+
+void ChirpingPhasorToneGenerator::unwrappedTrack( CompensatedAngle & theta, CompensatedAngle & omega ) const
+{
+    // As with our wrapped track, but without any reduction.
+    const auto m = static_cast< double >( sampleCounter - trackSample );
+    const CompensatedAngle halfAccel{ accelOver2, 0.0 };
+    const auto thetaInc = add( mul( trackOmegaUnwrapped, m ), mul( mul( halfAccel, m ), m ) );
+    const auto omegaInc = mul( halfAccel, 2.0 * m );
+    theta = add( trackThetaUnwrapped, thetaInc );
+    omega = add( trackOmegaUnwrapped, omegaInc );
+}
+
+void ChirpingPhasorToneGenerator::resync()
+{
+    // The resync countdown is kept apart from the track, which is also re-anchored by modifyAccel.
+    // Otherwise, frequent acceleration modifications would postpone resyncs indefinitely.
+    advanceTrack();
+    lastResyncSample = sampleCounter;
+
+    // Our `phasor` is simply the exact phase at the current sample. Our `rate` is re-seeded
+    // exactly as it would be in the reset operation, with the current angular velocity taking
+    // the place of `omegaZero`.
+    phasor = std::polar( 1.0, trackTheta.hi );
+    rate.reset( 2.0 * accelOver2, trackOmega.hi + accelOver2 );
+}
+
+ChirpingPhasorToneGenerator::StateSnapshot ChirpingPhasorToneGenerator::saveState() const
+{
+    StateSnapshot state{};
+    state.accelOver2 = accelOver2;
+    state.phasor[0] = phasor.real();
+    state.phasor[1] = phasor.imag();
+    state.trackTheta = trackTheta;
+    state.trackOmega = trackOmega;
+    state.trackThetaUnwrapped = trackThetaUnwrapped;
+    state.trackOmegaUnwrapped = trackOmegaUnwrapped;
+    state.sampleCounter = sampleCounter;
+    state.trackSample = trackSample;
+    state.lastResyncSample = lastResyncSample;
+    state.resyncInterval = resyncInterval;
+    std::memcpy( state.rate, &rate, sizeof( rate ) );
+    return state;
+}
+
+void ChirpingPhasorToneGenerator::restoreState( const StateSnapshot & state )
+{
+    accelOver2 = state.accelOver2;
+    phasor = FlyingPhasorElementType{ state.phasor[0], state.phasor[1] };
+    trackTheta = state.trackTheta;
+    trackOmega = state.trackOmega;
+    trackThetaUnwrapped = state.trackThetaUnwrapped;
+    trackOmegaUnwrapped = state.trackOmegaUnwrapped;
+    sampleCounter = state.sampleCounter;
+    trackSample = state.trackSample;
+    lastResyncSample = state.lastResyncSample;
+    resyncInterval = state.resyncInterval;
+    std::memcpy( &rate, state.rate, sizeof( rate ) );
+}
+
+void ChirpingPhasorToneGenerator::restoreInitialState( const StateSnapshot & state )
+{
+    // The initial state carries no resync interval. Preserve ours, as the reset operation does.
+    const auto interval = resyncInterval;
+    restoreState( state );
+    resyncInterval = interval;
+}
+
+void ChirpingPhasorToneGenerator::makeInitialStates( const double * pAccel, const double * pOmegaZero,
+                                                     const double * pPhi, size_t numStates, StateSnapshot * pStates )
+{
+    static const FlyingPhasorSeeder seeder{};
+
+    // Work through the table in blocks. Each block's three starting angles per entry (phi, the rate's starting
+    // angle and its per sample rotation, the acceleration) are gathered into one contiguous array, and their
+    // cosines and sines computed by the vectorized batch sine and cosine.
+    constexpr size_t blockSize = 64;
+    double angles[ 3 * blockSize ];
+    double cosines[ 3 * blockSize ];
+    double sines[ 3 * blockSize ];
+
+    for ( size_t i0 = 0; numStates > i0; i0 += blockSize )
+    {
+        const auto count = numStates - i0 < blockSize ? numStates - i0 : blockSize;
+        const auto pBlockAccel = pAccel + i0;
+        const auto pBlockOmegaZero = pOmegaZero + i0;
+        const auto pBlockPhi = pPhi + i0;
+        for ( size_t i = 0; count != i; ++i )
+        {
+            angles[i] = pBlockPhi[i];
+            angles[ count + i ] = pBlockOmegaZero[i] + pBlockAccel[i] / 2.0;
+            angles[ 2 * count + i ] = pBlockAccel[i];
+        }
+        batchSinCos( angles, cosines, sines, 3 * count );
+
+        for ( size_t i = 0; count != i; ++i )
+        {
+            // As the reset operation would initialize an instance.
+            ///@see ChirpingPhasorToneGenerator::reset for a discussion on our initialization steps.
+            const auto omegaZero = pBlockOmegaZero[i];
+            auto & state = pStates[ i0 + i ];
+            state = StateSnapshot{};
+            state.accelOver2 = pBlockAccel[i] / 2.0;
+            state.phasor[0] = cosines[i];
+            state.phasor[1] = sines[i];
+            state.trackTheta = wrapAngle( pBlockPhi[i] );
+            state.trackOmega = wrapAngle( omegaZero );
+            state.trackThetaUnwrapped = CompensatedAngle{ pBlockPhi[i], 0.0 };
+            state.trackOmegaUnwrapped = CompensatedAngle{ omegaZero, 0.0 };
+            seeder.seed( state.rate, pBlockAccel[i], angles[ count + i ],
+                         cosines[ 2 * count + i ], sines[ 2 * count + i ], cosines[ count + i ], sines[ count + i ] );
+        }
+    }
+}
@@ -12,10 +12,15 @@
 
 #include "FlyingPhasorToneGenerator.h"
 
+#include <cstdint>
+
 namespace ReiserRT
 {
     namespace Signal
     {
+        class ComplexGaussianNoiseSource;
+        class AmplitudeTaper;
+
         /**
          * @brief Chirping Phasor Tone Generator
          *
@@ -55,6 +60,224 @@ namespace ReiserRT
              */
             void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
 
+            /**
+             * @brief Get Samples Operation (Two Span)
+             *
+             * This operation delivers 'N1 + N2' number samples from the tone generator, the first 'N1' into the first
+             * user provided buffer and the remaining 'N2' into the second. It exists to fill a wrapped region of
+             * a circular buffer in a single invocation, the second span typically being the start of the ring.
+             * The sample series is identical to that of a single getSamples invocation of 'N1 + N2' samples.
+             *
+             * @param pFirst User provided buffer large enough to hold 'numFirst' samples.
+             * @param numFirst The number of samples to be delivered to the first buffer.
+             * @param pSecond User provided buffer large enough to hold 'numSecond' samples.
+             * @param numSecond The number of samples to be delivered to the second buffer.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pFirst, size_t numFirst,
+                             FlyingPhasorElementBufferTypePtr pSecond, size_t numSecond );
+
+            /**
+             * @brief Get Samples With Tracks Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator into the user provided buffer,
+             * along with parallel tracks of the instantaneous angular velocity, omega(n), and the unwrapped phase,
+             * theta(n), of each sample. The tracks are computed from the closed form quadratic phase, which
+             * is maintained in compensated arithmetic, rather than from the samples. No inverse trigonometric
+             * functions are invoked. The tracks are unwrapped. They account for any acceleration
+             * modifications and they are unaffected by resynchronization.
+             *
+             * Any of the buffers may be null, in which case the corresponding output is not produced. Note that
+             * the recursion must still be run when the sample buffer is null, to maintain the machine's state.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples, or null.
+             * @param numSamples The number of samples to be delivered.
+             * @param pOmega User provided buffer for the angular velocity in radians per sample, or null.
+             * @param pTheta User provided buffer for the unwrapped phase in radians, or null.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                             double * pOmega, double * pTheta );
+
+            /**
+             * @brief Get Real Samples Operation
+             *
+             * This operation delivers the real part (cosine) of 'N' number samples from the tone generator into
+             * the user provided buffer. The recursion still runs in complex form, but only one component is
+             * stored, halving the output bandwidth and buffer footprint.
+             *
+             * @param pBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getRealSamples( double * pBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Real Samples Operation (Single Precision)
+             *
+             * As above, with the real parts rounded to single precision.
+             *
+             * @param pBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getRealSamples( float * pBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Imaginary Samples Operation
+             *
+             * This operation delivers the imaginary part (sine) of 'N' number samples from the tone generator into
+             * the user provided buffer. The recursion still runs in complex form, but only one component is
+             * stored, halving the output bandwidth and buffer footprint.
+             *
+             * @param pBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getImagSamples( double * pBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Imaginary Samples Operation (Single Precision)
+             *
+             * As above, with the imaginary parts rounded to single precision.
+             *
+             * @param pBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getImagSamples( float * pBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples With Noise Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator, with complex white Gaussian noise
+             * from the supplied noise source added, into the user provided buffer. The work is performed a
+             * cache resident block at a time so that the noise is added while the samples are still in cache,
+             * rather than in a separate pass over the buffer.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param noiseSource The noise source. Its noise power sets the signal to noise ratio, the signal
+             * having unit power.
+             */
+            void getSamplesWithNoise( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                      ComplexGaussianNoiseSource & noiseSource );
+
+            /**
+             * @brief Get Samples Tapered Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator, weighted by an amplitude taper,
+             * into the user provided buffer. The taper weights are produced within the generation loop. Each
+             * cosine term of the taper is produced by a rotating phasor recursion, renormalized as our own
+             * phasor is, so no cosine invocations are made per sample. Flat taper segments are generated without
+             * any weighting. Samples beyond the end of the taper are weighted by zero.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param taper The amplitude taper.
+             * @param taperOffset The taper sample index of the first sample delivered. This allows a tapered
+             * pulse to be delivered across multiple invocations.
+             */
+            void getSamplesTapered( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                    const AmplitudeTaper & taper, size_t taperOffset=0 );
+
+            /**
+             * @brief Get Samples Strided Operation
+             *
+             * This operation delivers 'N' number samples, every M-th sample of the tone generator's series,
+             * into the user provided buffer without computing the samples skipped over. Every M-th sample of a
+             * chirp is itself a chirp with acceleration, accel * M^2, and starting angular velocity, omega(s) * M,
+             * where omega(s) is the angular velocity at the current sample. A temporary rate phasor
+             * is seeded accordingly, and afterwards our own `rate` attribute is re-seeded with the angular
+             * velocity at sample, s + N * M. The sample counter advances by N * M and subsequent contiguous usage
+             * carries on from there. If resynchronization is enabled, it is honored at stride granularity.
+             *
+             * @throw Throws std::invalid_argument if the stride is zero.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @param stride The number of generator samples to advance per sample delivered (M).
+             */
+            void getSamplesStrided( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, size_t stride );
+
+            /**
+             * @brief The largest gap, in samples, which the evaluateAt operation steps the recursion across.
+             * Larger gaps are crossed by re-seeding the recursion from the closed form quadratic phase.
+             */
+            static constexpr size_t maxSteppedGap = 32;
+
+            /**
+             * @brief Evaluate At Operation
+             *
+             * This operation delivers the samples at irregular sample offsets from the next sample to be retrieved
+             * (offset zero being that of peekNextSample), as with jittered sample times or spot checks of
+             * very long runs. The offsets must be sorted, in non-decreasing order. A private copy of the recursion
+             * is stepped across gaps of up to maxSteppedGap samples. Larger gaps are crossed by re-seeding the copy
+             * from the closed form quadratic phase, at the current acceleration. The re-seeds of a block of offsets
+             * are gathered and their cosines and sines computed together, by the same vectorized batch sine and
+             * cosine as the makeInitialStates operation, within an ulp of the standard library.
+             *
+             * No work is performed on the machine, so subsequent samples are unaffected.
+             *
+             * @throw Throws std::invalid_argument if the offsets are not sorted.
+             *
+             * @param pOffsets The sample offsets, in non-decreasing order.
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of offsets, and samples to be delivered.
+             */
+            void evaluateAt( const uint64_t * pOffsets, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                             size_t numSamples ) const;
+
+            /**
+             * @brief Evaluate At Operation (Fractional Time)
+             *
+             * As above, at fractional sample offsets, in any order. A fractional gap cannot be stepped across
+             * by the recursion, so every sample is evaluated from the closed form quadratic phase, with the
+             * cosines and sines of a block of samples computed by the batch sine and cosine.
+             *
+             * @param pTimes The offsets in samples, which may be fractional.
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of offsets, and samples to be delivered.
+             */
+            void evaluateAt( const double * pTimes, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                             size_t numSamples ) const;
+
+            /**
+             * @brief Generate Operation
+             *
+             * This operation delivers 'N' number samples from the tone generator to a user provided visitor,
+             * one sample at a time, instead of writing them to a buffer. It is intended for consumers which
+             * immediately reduce the samples (e.g., correlate and sum, power estimation). Being defined in the
+             * header, the visitor may be inlined so that generation and consumption fuse in registers.
+             * The sample series is identical to that delivered by the getSamples operation, including any
+             * resynchronization.
+             *
+             * @tparam Visitor A callable type invocable as, visitor( const FlyingPhasorElementType & sample ).
+             * @param numSamples The number of samples to be delivered.
+             * @param visitor The visitor invoked with each sample in order.
+             */
+            template< typename Visitor >
+            void generate( size_t numSamples, Visitor && visitor )
+            {
+                while ( numSamples )
+                {
+                    // Work up to the next resync point (if enabled), or the entire request otherwise.
+                    const auto untilResync = samplesUntilResync();
+                    const auto count = numSamples < untilResync ? numSamples : untilResync;
+
+                    for ( size_t i = 0; count != i; ++i )
+                    {
+                        // We always start with the current phasor to nail the very first sample (s0)
+                        // and advance (rotate) afterward.
+                        visitor( static_cast< const FlyingPhasorElementType & >( phasor ) );
+
+                        // Now advance (rotate) the phasor by our "dynamic" rate (complex multiply).
+                        phasor *= rate.getSample();
+
+                        // Perform normalization work. This only actually normalized ever other invocation.
+                        // We invoke it to maintain that part of the state machine.
+                        normalize();
+                    }
+                    numSamples -= count;
+
+                    if ( count == untilResync ) resync();
+                }
+            }
+
             /**
              * @brief Get Sample Operation
              *
@@ -129,6 +352,31 @@ namespace ReiserRT
              */
             inline const FlyingPhasorElementType & peekNextSample() const { return phasor; }
 
+            /**
+             * @brief Set Resync Interval
+             *
+             * This operation enables (or disables) periodic exact resynchronization. The normalize operation
+             * only corrects magnitude. Phase error from the recursive complex multiplies, both ours and those
+             * within our `rate` attribute, slowly accumulates over very long runs. When enabled, every `interval`
+             * samples, our `phasor` and `rate` attributes are re-seeded from the closed form quadratic phase,
+             * which is tracked in compensated (double-double) arithmetic modulo two pi. This bounds the phase error for
+             * arbitrarily long runs at the cost of a few trigonometric invocations per interval.
+             *
+             * The resync interval counts from the point of this invocation, or of the last resynchronization,
+             * and survives the reset operation. Acceleration modifications do not postpone it.
+             *
+             * @param interval Number of samples between resynchronizations. Zero (the default) disables
+             * resynchronization entirely.
+             */
+            void setResyncInterval( size_t interval );
+
+            /**
+             * @brief Get Resync Interval
+             *
+             * @return Returns the current resync interval in samples. Zero indicates disabled.
+             */
+            inline size_t getResyncInterval() const { return resyncInterval; }
+
         private:
             /**
              * @brief The Normalize Operation.
@@ -155,11 +403,159 @@ namespace ReiserRT
                 }
             }
 
+            /**
+             * @brief The Advance Track Operation
+             *
+             * Brings our closed form phase and angular velocity track up to the current sample counter.
+             * This is accomplished incrementally in compensated arithmetic with every term reduced
+             * modulo two pi, so that the magnitude of the sample counter does not erode precision.
+             */
+            void advanceTrack();
+
+            /**
+             * @brief The Resync Operation
+             *
+             * Re-seeds our `phasor` and `rate` attributes from the closed form track at the current sample.
+             */
+            void resync();
+
+            /**
+             * @brief Resync Due Check
+             *
+             * @return Returns the number of samples that may be produced before the next resync is due.
+             * If resynchronization is disabled, the maximum size_t value is returned.
+             */
+            inline size_t samplesUntilResync() const
+            {
+                return resyncInterval ? lastResyncSample + resyncInterval - sampleCounter : size_t( -1 );
+            }
+
+        public:
+            /**
+             * @brief Compensated Angle
+             *
+             * An angle held as the unevaluated sum of two doubles (double-double) which provides
+             * roughly twice the precision of a double on every platform.
+             */
+            struct CompensatedAngle
+            {
+                double hi;  //!< The leading part, the angle rounded to double precision.
+                double lo;  //!< The trailing part, the rounding error of the leading part.
+            };
+
+            /**
+             * @brief State Snapshot
+             *
+             * A fixed size, trivially copyable capture of the complete state of an instance. It may be
+             * memcpy'd, written to a file or placed in shared memory, and later restored into any instance
+             * built from the same library version, resuming the sample series bit for bit with no recompute.
+             */
+            struct StateSnapshot
+            {
+                FlyingPhasorPrecisionType accelOver2;   //!< Captured `accelOver2` attribute.
+                FlyingPhasorPrecisionType phasor[2];    //!< Captured `phasor` attribute (real, imaginary).
+                CompensatedAngle trackTheta;            //!< Captured `trackTheta` attribute.
+                CompensatedAngle trackOmega;            //!< Captured `trackOmega` attribute.
+                CompensatedAngle trackThetaUnwrapped;   //!< Captured `trackThetaUnwrapped` attribute.
+                CompensatedAngle trackOmegaUnwrapped;   //!< Captured `trackOmegaUnwrapped` attribute.
+                uint64_t sampleCounter;                 //!< Captured `sampleCounter` attribute.
+                uint64_t trackSample;                   //!< Captured `trackSample` attribute.
+                uint64_t lastResyncSample;              //!< Captured `lastResyncSample` attribute.
+                uint64_t resyncInterval;                //!< Captured `resyncInterval` attribute.
+
+                /// Captured `rate` attribute, the raw representation of the FlyingPhasorToneGenerator.
+                alignas( FlyingPhasorToneGenerator ) unsigned char rate[ sizeof( FlyingPhasorToneGenerator ) ];
+            };
+
+            /**
+             * @brief Save State Operation
+             *
+             * This operation captures the complete state of the instance. No work is performed on the machine.
+             *
+             * @return Returns a snapshot from which the instance may later be restored.
+             */
+            StateSnapshot saveState() const;
+
+            /**
+             * @brief Restore State Operation
+             *
+             * This operation restores the complete state of the instance from a snapshot. Subsequent samples
+             * are bit for bit identical to those the captured instance would have produced.
+             *
+             * @param state A snapshot obtained from the saveState operation.
+             */
+            void restoreState( const StateSnapshot & state );
+
+            /**
+             * @brief Make Initial States Operation
+             *
+             * This operation computes the states that instances constructed with each of the given parameter
+             * sets would capture via the saveState operation, without constructing any instances. Parameters are
+             * supplied as a structure of arrays. The cosines and sines of the three starting phasors of each entry
+             * (the phase, the rate and the acceleration) are computed in contiguous blocks of the parameter table
+             * by a branch free polynomial kernel, which compilers vectorize, rather than by the standard library.
+             * The states may later be applied to instances via the restoreInitialState operation, without further
+             * transcendental invocations.
+             *
+             * The starting phasors are within an ulp of those the reset operation computes, but not always
+             * identical to them. Sample n of an instance so initialized may therefore differ from that of a reset
+             * instance by about ( 1 + n + n * n / 2 ) * 1.6e-16, until a resynchronization re-seeds both alike.
+             *
+             * @param pAccel Array of accelerations in radians per sample, per sample.
+             * @param pOmegaZero Array of starting angular velocities in radians per sample.
+             * @param pPhi Array of starting phase angles in radians.
+             * @param numStates The number of entries in each of the arrays.
+             * @param pStates User provided array of numStates snapshots to be overwritten.
+             */
+            static void makeInitialStates( const double * pAccel, const double * pOmegaZero, const double * pPhi,
+                                           size_t numStates, StateSnapshot * pStates );
+
+            /**
+             * @brief Restore Initial State Operation
+             *
+             * This operation applies a state obtained from the makeInitialStates operation. It stands in for
+             * invoking the reset operation with the same parameters, within the rounding of the starting phasors
+             * described there and, as with reset, the resync interval is preserved.
+             *
+             * @param state An initial state obtained from the makeInitialStates operation.
+             */
+            void restoreInitialState( const StateSnapshot & state );
+
         private:
+            /**
+             * @brief Unwrapped Track At Current Sample
+             *
+             * Evaluates the unwrapped phase and angular velocity at the current sample counter from the
+             * closed form track, without re-anchoring the track.
+             *
+             * @param theta Receives the unwrapped phase.
+             * @param omega Receives the unwrapped angular velocity.
+             */
+            void unwrappedTrack( CompensatedAngle & theta, CompensatedAngle & omega ) const;
+
+            /**
+             * @brief Wrapped Track At Offset
+             *
+             * Evaluates the phase and angular velocity, both modulo two pi, at an offset from `trackSample`,
+             * at the current acceleration, without re-anchoring the track.
+             *
+             * @param m The offset from `trackSample` in samples, which may be fractional.
+             * @param theta Receives the phase.
+             * @param omega Receives the angular velocity.
+             */
+            void wrappedTrack( double m, CompensatedAngle & theta, CompensatedAngle & omega ) const;
+
             FlyingPhasorPrecisionType accelOver2;   //!< A useful internal quantity.
             FlyingPhasorToneGenerator rate;         //!< Dynamic angular rate provider (sample to sample, omegaBar)
             FlyingPhasorElementType phasor;         //!< Phase angle of next sample.
             size_t sampleCounter;                   //!< Tracks sample count used or renormalization purposes.
+            CompensatedAngle trackTheta;            //!< Exact phase (modulo two pi) at `trackSample`.
+            CompensatedAngle trackOmega;            //!< Exact angular velocity (modulo two pi) at `trackSample`.
+            CompensatedAngle trackThetaUnwrapped;   //!< Unwrapped phase at `trackSample`.
+            CompensatedAngle trackOmegaUnwrapped;   //!< Unwrapped angular velocity at `trackSample`.
+            size_t trackSample;                     //!< Sample number of the closed form track.
+            size_t lastResyncSample;                //!< Sample number the resync interval counts from.
+            size_t resyncInterval;                  //!< Samples between resynchronizations, zero if disabled.
         };
     }
 }
@@ -0,0 +1,189 @@
+/**
+ * @file ComplexGaussianNoiseSource.cpp
+ * @brief The implementation file for the Complex Gaussian Noise Source.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "ComplexGaussianNoiseSource.h"
+
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // The splitmix64 generator, used to expand a seed into generator state.
+    inline uint64_t splitMix64( uint64_t & x )
+    {
+        auto z = ( x += 0x9E3779B97F4A7C15ULL );
+        z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+        z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+        return z ^ ( z >> 31 );
+    }
+
+    // Ziggurat tables for the standard normal density with 128 layers (Marsaglia and Tsang, with the
+    // refinements of Doornik). Layer 0 is the base strip including the tail beyond `tailStart`.
+    struct ZigguratTables
+    {
+        static constexpr size_t numLayers = 128;
+        static constexpr double tailStart = 3.442619855899;
+        static constexpr double layerArea = 9.91256303526217e-3;
+
+        ZigguratTables()
+        {
+            auto f = std::exp( -0.5 * tailStart * tailStart );
+            x[0] = layerArea / f;
+            x[1] = tailStart;
+            x[ numLayers ] = 0.0;
+            for ( size_t i = 2; numLayers != i; ++i )
+            {
+                x[i] = std::sqrt( -2.0 * std::log( layerArea / x[ i - 1 ] + f ) );
+                f = std::exp( -0.5 * x[i] * x[i] );
+            }
+            for ( size_t i = 0; numLayers != i; ++i )
+                ratio[i] = x[ i + 1 ] / x[i];
+        }
+
+        double x[ numLayers + 1 ];      // Layer edges.
+        double ratio[ numLayers ];      // Fraction of each layer wholly beneath the density.
+    };
+
+    constexpr size_t ZigguratTables::numLayers;
+    constexpr double ZigguratTables::tailStart;
+    constexpr double ZigguratTables::layerArea;
+
+    const ZigguratTables & zigguratTables()
+    {
+        static const ZigguratTables tables{};
+        return tables;
+    }
+
+    constexpr double twoToMinus53 = 1.0 / 9007199254740992.0;
+
+    // Uniform deviate on (0, 1), from the upper 53 bits.
+    inline double openUniform( uint64_t r ) { return ( static_cast< double >( r >> 11 ) + 0.5 ) * twoToMinus53; }
+}
+
+constexpr size_t ComplexGaussianNoiseSource::blockSize;
+
+ComplexGaussianNoiseSource::ComplexGaussianNoiseSource( uint64_t seed, uint64_t streamId, double theNoisePower )
+  : state{}
+  , noisePower{ theNoisePower }
+  , realBlock{}
+  , imagBlock{}
+  , readIndex{ blockSize }
+{
+    reseed( seed, streamId );
+}
+
+void ComplexGaussianNoiseSource::reseed( uint64_t seed, uint64_t streamId )
+{
+    // Mix the stream identifier into the seed through splitmix64 itself so that neighboring seeds
+    // and stream identifiers do not yield related states.
+    auto x = seed;
+    const auto mixed = splitMix64( x ) ^ streamId;
+    x = mixed;
+    for ( auto & s : state ) s = splitMix64( x );
+
+    // Any buffered samples are discarded.
+    readIndex = blockSize;
+}
+
+void ComplexGaussianNoiseSource::setNoisePower( double theNoisePower )
+{
+    // Buffered samples were scaled by the prior noise power. Discard them so that the new power takes
+    // effect immediately.
+    noisePower = theNoisePower;
+    readIndex = blockSize;
+}
+
+double ComplexGaussianNoiseSource::noisePowerForSnr( double signalPower, double snrDb )
+{
+    return signalPower * std::pow( 10.0, -snrDb / 10.0 );
+}
+
+FlyingPhasorElementType ComplexGaussianNoiseSource::getSample()
+{
+    if ( blockSize == readIndex ) fillBlock();
+    const FlyingPhasorElementType sample{ realBlock[ readIndex ], imagBlock[ readIndex ] };
+    ++readIndex;
+    return sample;
+}
+
+void ComplexGaussianNoiseSource::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    while ( numSamples )
+    {
+        if ( blockSize == readIndex ) fillBlock();
+        const auto available = blockSize - readIndex;
+        const auto count = numSamples < available ? numSamples : available;
+        for ( size_t i = 0; count != i; ++i )
+            pElementBuffer[i] = FlyingPhasorElementType{ realBlock[ readIndex + i ], imagBlock[ readIndex + i ] };
+        pElementBuffer += count;
+        readIndex += count;
+        numSamples -= count;
+    }
+}
+
+void ComplexGaussianNoiseSource::addSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    while ( numSamples )
+    {
+        if ( blockSize == readIndex ) fillBlock();
+        const auto available = blockSize - readIndex;
+        const auto count = numSamples < available ? numSamples : available;
+        for ( size_t i = 0; count != i; ++i )
+            pElementBuffer[i] += FlyingPhasorElementType{ realBlock[ readIndex + i ], imagBlock[ readIndex + i ] };
+        pElementBuffer += count;
+        readIndex += count;
+        numSamples -= count;
+    }
+}
+
+double ComplexGaussianNoiseSource::standardNormal()
+{
+    const auto & zig = zigguratTables();
+    for (;;)
+    {
+        // A single draw supplies both the layer, from its low bits, and a uniform deviate on (-1, 1),
+        // from its upper 53 bits.
+        const auto r = next();
+        const auto layer = static_cast< size_t >( r & ( ZigguratTables::numLayers - 1 ) );
+        const auto u = 2.0 * openUniform( r ) - 1.0;
+
+        // The overwhelmingly common case, the point lies in the part of the layer wholly beneath the density.
+        if ( std::abs( u ) < zig.ratio[ layer ] ) return u * zig.x[ layer ];
+
+        // The base strip, sample from the tail by Marsaglia's method.
+        if ( 0 == layer )
+        {
+            double x, y;
+            do
+            {
+                x = std::log( openUniform( next() ) ) / ZigguratTables::tailStart;
+                y = std::log( openUniform( next() ) );
+            } while ( -2.0 * y < x * x );
+            return u < 0.0 ? x - ZigguratTables::tailStart : ZigguratTables::tailStart - x;
+        }
+
+        // The wedge, accept if the point lies beneath the density.
+        const auto x = u * zig.x[ layer ];
+        const auto f0 = std::exp( -0.5 * ( zig.x[ layer ] * zig.x[ layer ] - x * x ) );
+        const auto f1 = std::exp( -0.5 * ( zig.x[ layer + 1 ] * zig.x[ layer + 1 ] - x * x ) );
+        if ( f1 + openUniform( next() ) * ( f0 - f1 ) < 1.0 ) return x;
+    }
+}
+
+void ComplexGaussianNoiseSource::fillBlock()
+{
+    // Each component has variance, noisePower / 2.
+    const auto scale = std::sqrt( noisePower / 2.0 );
+    for ( size_t i = 0; blockSize != i; ++i )
+    {
+        realBlock[i] = scale * standardNormal();
+        imagBlock[i] = scale * standardNormal();
+    }
+
+    readIndex = 0;
+}
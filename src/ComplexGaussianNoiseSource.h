@@ -0,0 +1,159 @@
+/**
+ * @file ComplexGaussianNoiseSource.h
+ * @brief The specification file for the Complex Gaussian Noise Source.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_COMPLEXGAUSSIANNOISESOURCE_H
+#define REISER_RT_COMPLEXGAUSSIANNOISESOURCE_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Complex Gaussian Noise Source
+         *
+         * This class produces seeded, reproducible, circularly symmetric complex white Gaussian noise.
+         * Uniform deviates come from a xoshiro256++ generator and are transformed to normal deviates by the
+         * ziggurat method. Nearly always, a normal deviate costs one draw, one multiply and one comparison,
+         * with no transcendental invocations. Samples are produced a block at a time into an internal buffer.
+         * All operations consume that same buffered sequence, so the noise obtained for a given seed does not
+         * depend upon how it is requested.
+         *
+         * Independent streams, for parallel runs for instance, are obtained by supplying the same seed with
+         * differing stream identifiers. The seed and stream identifier are mixed through splitmix64 to form the
+         * generator state, as recommended by the xoshiro authors.
+         *
+         * @note Instances are not thread safe. Use one instance, with its own stream identifier, per thread.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT ComplexGaussianNoiseSource
+        {
+        public:
+            /**
+             * @brief Constructor
+             *
+             * @param seed The seed.
+             * @param streamId The stream identifier. Differing identifiers yield independent streams.
+             * @param noisePower The noise power, the expected value of the squared magnitude of a sample.
+             */
+            explicit ComplexGaussianNoiseSource( uint64_t seed=0, uint64_t streamId=0, double noisePower=1.0 );
+
+            /**
+             * @brief Reseed Operation
+             *
+             * Restarts the noise sequence as if just constructed with the seed and stream identifier.
+             * The noise power is retained.
+             *
+             * @param seed The seed.
+             * @param streamId The stream identifier.
+             */
+            void reseed( uint64_t seed, uint64_t streamId=0 );
+
+            /**
+             * @brief Set Noise Power
+             *
+             * @param noisePower The noise power, the expected value of the squared magnitude of a sample.
+             */
+            void setNoisePower( double noisePower );
+
+            /**
+             * @brief Get Noise Power
+             *
+             * @return Returns the noise power.
+             */
+            inline double getNoisePower() const { return noisePower; }
+
+            /**
+             * @brief Noise Power For SNR
+             *
+             * @param signalPower The signal power. One for the unscaled tone generators of this library.
+             * @param snrDb The desired signal to noise ratio in decibels.
+             * @return Returns the noise power yielding the signal to noise ratio.
+             */
+            static double noisePowerForSnr( double signalPower, double snrDb );
+
+            /**
+             * @brief Get Sample Operation
+             *
+             * @return Returns the next noise sample.
+             */
+            FlyingPhasorElementType getSample();
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' noise samples into the user provided buffer, overwriting it.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Add Samples Operation
+             *
+             * Adds 'N' noise samples to the contents of the user provided buffer.
+             *
+             * @param pElementBuffer User provided buffer holding at least the requested number of samples.
+             * @param numSamples The number of samples to be added.
+             */
+            void addSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief The number of samples produced per block.
+             */
+            static constexpr size_t blockSize = 128;
+
+        private:
+            /**
+             * @brief The Fill Block Operation
+             *
+             * Produces the next block of noise samples into our buffers and rewinds our read index.
+             */
+            void fillBlock();
+
+            /**
+             * @brief The Standard Normal Operation
+             *
+             * @return Returns the next standard normal deviate by the ziggurat method.
+             */
+            double standardNormal();
+
+            /**
+             * @brief The Next Operation
+             *
+             * @return Returns the next xoshiro256++ output.
+             */
+            inline uint64_t next()
+            {
+                const auto result = rotl( state[0] + state[3], 23 ) + state[0];
+                const auto t = state[1] << 17;
+                state[2] ^= state[0];
+                state[3] ^= state[1];
+                state[1] ^= state[2];
+                state[0] ^= state[3];
+                state[2] ^= t;
+                state[3] = rotl( state[3], 45 );
+                return result;
+            }
+
+            static inline uint64_t rotl( uint64_t x, int k ) { return ( x << k ) | ( x >> ( 64 - k ) ); }
+
+            uint64_t state[4];                  //!< The xoshiro256++ state.
+            double noisePower;                  //!< The noise power.
+            double realBlock[ blockSize ];      //!< Real parts of the current block.
+            double imagBlock[ blockSize ];      //!< Imaginary parts of the current block.
+            size_t readIndex;                   //!< Index of the next unread sample of the current block.
+        };
+    }
+}
+
+#endif //REISER_RT_COMPLEXGAUSSIANNOISESOURCE_H
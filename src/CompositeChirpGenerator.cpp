@@ -0,0 +1,111 @@
+/**
+ * @file CompositeChirpGenerator.cpp
+ * @brief The implementation file for the Composite Chirp Generator.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "CompositeChirpGenerator.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class CompositeChirpGenerator::Imple
+{
+public:
+    // The number of output samples per block. 16 KiB of samples fits in L1 cache.
+    static constexpr size_t blockSize = 1024;
+
+    Imple( const Component * pComponents, size_t numComponents )
+      : components( pComponents, pComponents + numComponents )
+      , amplitudes( numComponents )
+      , generators( numComponents )
+      , sampleCounter{}
+    {
+        reset();
+    }
+
+    void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+    {
+        while ( numSamples )
+        {
+            const auto count = numSamples < blockSize ? numSamples : blockSize;
+            std::fill( pElementBuffer, pElementBuffer + count, FlyingPhasorElementType{} );
+
+            // Every component accumulates into the block while it remains cache resident.
+            const auto numComponents = generators.size();
+            for ( size_t k = 0; numComponents != k; ++k )
+            {
+                const auto amplitude = amplitudes[k];
+                auto p = pElementBuffer;
+                generators[k].generate( count, [&p, amplitude]( const FlyingPhasorElementType & sample ) {
+                    *p++ += amplitude * sample;
+                } );
+            }
+
+            pElementBuffer += count;
+            numSamples -= count;
+            sampleCounter += count;
+        }
+    }
+
+    void reset()
+    {
+        const auto numComponents = components.size();
+        for ( size_t k = 0; numComponents != k; ++k )
+        {
+            const auto & component = components[k];
+            generators[k].reset( component.accel, component.omegaZero, component.phi );
+            amplitudes[k] = component.amplitude;
+        }
+        sampleCounter = 0;
+    }
+
+    const std::vector< Component > components;
+    std::vector< FlyingPhasorElementType > amplitudes;
+    std::vector< ChirpingPhasorToneGenerator > generators;
+    size_t sampleCounter;
+};
+
+constexpr size_t CompositeChirpGenerator::Imple::blockSize;
+
+CompositeChirpGenerator::CompositeChirpGenerator( const Component * pComponents, size_t numComponents )
+  : pImple{ new Imple{ pComponents, numComponents } }
+{
+}
+
+CompositeChirpGenerator::~CompositeChirpGenerator()
+{
+    delete pImple;
+}
+
+void CompositeChirpGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->getSamples( pElementBuffer, numSamples );
+}
+
+void CompositeChirpGenerator::setAmplitude( size_t index, const FlyingPhasorElementType & amplitude )
+{
+    if ( index >= pImple->amplitudes.size() )
+        throw std::out_of_range{ "CompositeChirpGenerator::setAmplitude index out of range" };
+    pImple->amplitudes[ index ] = amplitude;
+}
+
+void CompositeChirpGenerator::reset()
+{
+    pImple->reset();
+}
+
+size_t CompositeChirpGenerator::getNumComponents() const
+{
+    return pImple->generators.size();
+}
+
+size_t CompositeChirpGenerator::getSampleCount() const
+{
+    return pImple->sampleCounter;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file CompositeChirpGenerator.h
+ * @brief The specification file for the Composite Chirp Generator.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_COMPOSITECHIRPGENERATOR_H
+#define REISER_RT_COMPOSITECHIRPGENERATOR_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Composite Chirp Generator
+         *
+         * This class produces the sum of K concurrent chirps, each with its own complex amplitude, as needed
+         * for interference and multi-emitter scenarios. Summing the output of K ChirpingPhasorToneGenerator
+         * instances streams the whole output buffer through cache K times. Here, the output is produced a
+         * cache sized block at a time. All K chirp recursions advance across a block, accumulating into it while
+         * it is cache resident, before moving on to the next block. The output buffer is thus streamed once.
+         *
+         * Each component's sample series is identical to that of a ChirpingPhasorToneGenerator constructed
+         * with the component's parameters.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT CompositeChirpGenerator
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Component
+             *
+             * The description of a single chirp of the composite.
+             */
+            struct Component
+            {
+                double accel;                           //!< Acceleration in radians per sample, per sample.
+                double omegaZero;                       //!< Starting angular velocity in radians per sample.
+                double phi;                             //!< Starting phase angle in radians.
+                FlyingPhasorElementType amplitude;      //!< Complex amplitude.
+            };
+
+            /**
+             * @brief Constructor
+             *
+             * @param pComponents Array of components, copied.
+             * @param numComponents Number of components.
+             */
+            CompositeChirpGenerator( const Component * pComponents, size_t numComponents );
+
+            /**
+             * @brief Destructor
+             */
+            ~CompositeChirpGenerator();
+
+            CompositeChirpGenerator( const CompositeChirpGenerator & another ) = delete;
+            CompositeChirpGenerator & operator=( const CompositeChirpGenerator & another ) = delete;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' samples of the composite into the user provided buffer, overwriting it.
+             * Subsequent invocations continue on in phase with those previous.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Set Amplitude Operation
+             *
+             * Changes the amplitude of a component, effective with the next sample delivered.
+             *
+             * @throw Throws std::out_of_range if the index is not that of a component.
+             *
+             * @param index The index of the component.
+             * @param amplitude The new complex amplitude.
+             */
+            void setAmplitude( size_t index, const FlyingPhasorElementType & amplitude );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Restarts every component from sample zero with its original amplitude.
+             */
+            void reset();
+
+            /**
+             * @brief Get Number of Components
+             *
+             * @return Returns the number of components.
+             */
+            size_t getNumComponents() const;
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @return Returns the number of samples delivered since construction or reset.
+             */
+            size_t getSampleCount() const;
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_COMPOSITECHIRPGENERATOR_H
@@ -0,0 +1,256 @@
+/**
+ * @file ConstexprChirpTable.h
+ * @brief Compile time generation of chirp tables for read only memory.
+ *
+ * The library itself is built to the C++11 standard. The facilities in this header require C++14
+ * relaxed constexpr functions and are only made available to clients compiled as C++14 or later.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_CONSTEXPRCHIRPTABLE_H
+#define REISER_RT_CONSTEXPRCHIRPTABLE_H
+
+#if defined( _MSVC_LANG )
+#define REISER_RT_CONSTEXPR_CHIRP_CPLUSPLUS _MSVC_LANG
+#else
+#define REISER_RT_CONSTEXPR_CHIRP_CPLUSPLUS __cplusplus
+#endif
+
+#if REISER_RT_CONSTEXPR_CHIRP_CPLUSPLUS >= 201402L
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Implementation details of the compile time chirp tables. Not for direct use.
+         */
+        namespace ConstexprChirpDetail
+        {
+            /**
+             * @brief A minimal constexpr complex value, std::complex not being a literal type we can mutate under C++14.
+             */
+            struct Phasor
+            {
+                double re;  //!< Real part.
+                double im;  //!< Imaginary part.
+            };
+
+            /**
+             * @brief Complex multiply in rectangular form, as performed by the runtime tone generators.
+             */
+            constexpr Phasor multiply( const Phasor & a, const Phasor & b )
+            {
+                return Phasor{ a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re };
+            }
+
+            /**
+             * @brief The first order Taylor Series re-normalization of the runtime tone generators.
+             */
+            constexpr Phasor normalize( const Phasor & p )
+            {
+                const double d = 1.0 - ( p.re * p.re + p.im * p.im - 1.0 ) / 2.0;
+                return Phasor{ p.re * d, p.im * d };
+            }
+
+            /**
+             * @brief Unit Phasor at Angle
+             *
+             * A constexpr equivalent of std::polar( 1.0, x ). The argument is reduced to [-pi/4, pi/4], as a head
+             * and tail pair, by a Cody-Waite reduction and the sine and cosine are evaluated with the minimax
+             * polynomial kernels of fdlibm. Each component is within an ulp (1.2e-16 absolute) of std::polar,
+             * but not always identical to it. The two agree exactly for the large majority of arguments.
+             */
+            constexpr Phasor polar( double x )
+            {
+                // Nearest multiple of pi/2. We cannot use std::round in a constexpr function.
+                const double t = x * 6.36619772367581382433e-01;
+                const long long k = t >= 0.0 ? static_cast< long long >( t + 0.5 )
+                                             : -static_cast< long long >( -t + 0.5 );
+                const double fk = static_cast< double >( k );
+
+                // Reduce by pi/2 held in three parts. The leading parts have enough trailing zero bits
+                // that their products with k are exact.
+                const double r1 = x - fk * 1.57079632673412561417e+00;
+                const double w1 = fk * 6.07710050630396597660e-11;
+                const double r2 = r1 - w1;
+                const double w2 = fk * 2.02226624871116645580e-21 - ( ( r1 - r2 ) - w1 );
+                const double r = r2 - w2;
+                const double y = ( r2 - r ) - w2;
+
+                const double z = r * r;
+                const double v = z * r;
+                const double sr = 8.33333333332248946124e-03 + z * ( -1.98412698298579493134e-04
+                                + z * ( 2.75573137070700676789e-06 + z * ( -2.50507602534068634195e-08
+                                + z * 1.58969099521155010221e-10 ) ) );
+                const double s = r - ( ( z * ( 0.5 * y - v * sr ) - y ) - v * -1.66666666666666324348e-01 );
+
+                const double cr = z * ( 4.16666666666666019037e-02 + z * ( -1.38888888888741095749e-03
+                                + z * ( 2.48015872894767294178e-05 + z * ( -2.75573143513906633035e-07
+                                + z * ( 2.08757232129817482790e-09 + z * -1.13596475577881948265e-11 ) ) ) ) );
+                const double hz = 0.5 * z;
+                const double w = 1.0 - hz;
+                const double c = w + ( ( ( 1.0 - w ) - hz ) + ( z * cr - r * y ) );
+
+                switch ( k & 0x3 )
+                {
+                    case 0: return Phasor{ c, s };
+                    case 1: return Phasor{ -s, c };
+                    case 2: return Phasor{ -c, -s };
+                    default: return Phasor{ s, -c };
+                }
+            }
+
+            /**
+             * @brief Raw table of samples in double precision, mutable within a constexpr function.
+             */
+            template< size_t N >
+            struct Samples
+            {
+                double re[N];   //!< Real parts.
+                double im[N];   //!< Imaginary parts.
+            };
+
+            /**
+             * @brief Run the chirp recursion of ChirpingPhasorToneGenerator for N samples.
+             *
+             * Our `phasor` is advanced by the `rate` phasor, which is itself advanced by a fixed `accel` phasor as a
+             * FlyingPhasorToneGenerator would be. Each is re-normalized every other sample, exactly as at runtime.
+             */
+            template< size_t N >
+            constexpr Samples< N > generate( double accel, double omegaZero, double phi )
+            {
+                Samples< N > samples{};
+
+                const double accelOver2 = accel / 2.0;
+                Phasor phasor = polar( phi );
+                Phasor rate = polar( omegaZero + accelOver2 );
+                const Phasor rateRate = polar( accel );
+
+                for ( size_t i = 0; N != i; ++i )
+                {
+                    samples.re[i] = phasor.re;
+                    samples.im[i] = phasor.im;
+
+                    // Advance our phasor by the rate's current sample, then the rate itself.
+                    phasor = multiply( phasor, rate );
+                    rate = multiply( rate, rateRate );
+
+                    // Both sample counters are equal to `i` here, so both normalize together on odd samples.
+                    if ( ( i & 0x1 ) == 0x1 )
+                    {
+                        rate = normalize( rate );
+                        phasor = normalize( phasor );
+                    }
+                }
+
+                return samples;
+            }
+
+            /**
+             * @brief Round to nearest, half away from zero, and saturate into 16 bits.
+             */
+            constexpr int16_t toInt16( double v )
+            {
+                const double r = v >= 0.0 ? v + 0.5 : v - 0.5;
+                return r >= 32767.0 ? int16_t{ 32767 }
+                     : r <= -32768.0 ? int16_t{ -32768 }
+                     : static_cast< int16_t >( static_cast< long >( r ) );
+            }
+
+            /**
+             * @brief Packs raw samples into a std::array of complex values.
+             */
+            template< typename T, size_t N, size_t... I >
+            constexpr std::array< std::complex< T >, N > toComplex( const Samples< N > & samples,
+                                                                     std::index_sequence< I... > )
+            {
+                return {{ std::complex< T >( static_cast< T >( samples.re[I] ), static_cast< T >( samples.im[I] ) )... }};
+            }
+
+            /**
+             * @brief Packs raw samples into a std::array of scaled, interleaved 16 bit integer pairs.
+             */
+            template< size_t N, size_t... I >
+            constexpr std::array< int16_t, 2 * N > toInt16( const Samples< N > & samples, double scale,
+                                                            std::index_sequence< I... > )
+            {
+                return {{ toInt16( scale * ( ( I & 0x1 ) ? samples.im[I / 2] : samples.re[I / 2] ) )... }};
+            }
+        }
+
+        /**
+         * @brief Make Chirp Table
+         *
+         * Produces a table of N chirp samples at compile time, when used to initialize a constexpr variable.
+         * The recursion is that of ChirpingPhasorToneGenerator constructed with the same parameters, including
+         * re-normalization every other sample, so a table held in read only memory costs nothing at startup.
+         * Samples are generated in double precision, as at runtime, and converted to the element precision `T`.
+         *
+         * The table is not guaranteed to be bit identical to the runtime generator. The recursion is seeded with
+         * three phasors (phase, rate and acceleration) computed by a constexpr polar, each of which may differ
+         * from the runtime's std::polar by an ulp. The recursion carries such differences forward, linearly for
+         * the rate and quadratically for the acceleration, so that in double precision, sample n agrees with
+         * the runtime generator to within about ( 1 + n + n * n / 2 ) * 1.6e-16 (3.4e-10 at n = 2048).
+         * In practice, the seeds most often agree exactly and so do the tables. This is far below the
+         * resolution of the float and 16 bit integer tables.
+         *
+         * @tparam N The number of samples of the table.
+         * @tparam T The precision of the complex elements, float by default.
+         * @param accel Acceleration in radians per sample, per sample.
+         * @param omegaZero Starting angular velocity in radians per sample.
+         * @param phi Starting phase in radians.
+         * @return Returns the table as a std::array of std::complex< T >.
+         */
+        template< size_t N, typename T = float >
+        constexpr std::array< std::complex< T >, N > makeChirpTable( double accel, double omegaZero, double phi=0.0 )
+        {
+            static_assert( N != 0, "A chirp table must have at least one sample" );
+            return ConstexprChirpDetail::toComplex< T >( ConstexprChirpDetail::generate< N >( accel, omegaZero, phi ),
+                                                         std::make_index_sequence< N >{} );
+        }
+
+        /**
+         * @brief Make 16 Bit Chirp Table
+         *
+         * Produces a table of N chirp samples as interleaved (real, imaginary) 16 bit integer pairs at compile time,
+         * when used to initialize a constexpr variable, as a digital to analog converter typically consumes them.
+         * Samples are those of makeChirpTable, multiplied by `scale` and rounded to nearest.
+         *
+         * @tparam N The number of samples of the table.
+         * @param accel Acceleration in radians per sample, per sample.
+         * @param omegaZero Starting angular velocity in radians per sample.
+         * @param phi Starting phase in radians.
+         * @param scale Full scale value, in the interval (0, 32767].
+         * @return Returns the table as a std::array of 2 * N int16_t.
+         *
+         * @throw Throws std::invalid_argument if scale is out of range. In a constant expression, this is a
+         * compilation error.
+         */
+        template< size_t N >
+        constexpr std::array< int16_t, 2 * N > makeChirpTableInt16( double accel, double omegaZero, double phi=0.0,
+                                                                    double scale=32767.0 )
+        {
+            static_assert( N != 0, "A chirp table must have at least one sample" );
+            return ( scale > 0.0 && scale <= 32767.0 )
+                 ? ConstexprChirpDetail::toInt16( ConstexprChirpDetail::generate< N >( accel, omegaZero, phi ), scale,
+                                                  std::make_index_sequence< 2 * N >{} )
+                 : throw std::invalid_argument( "The scale must be in the interval (0, 32767]" );
+        }
+    }
+}
+
+#endif
+
+#undef REISER_RT_CONSTEXPR_CHIRP_CPLUSPLUS
+
+#endif //REISER_RT_CONSTEXPRCHIRPTABLE_H
@@ -0,0 +1,185 @@
+/**
+ * @file DdsChirpGenerator.cpp
+ * @brief The implementation file for the Direct Digital Synthesis (DDS) Chirp Generator.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "DdsChirpGenerator.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+constexpr unsigned DdsChirpGenerator::interpolationBits;
+constexpr size_t DdsChirpGenerator::blockSize;
+
+namespace
+{
+    constexpr double twoPi = 2.0 * M_PI;
+
+    void validateAddressBits( unsigned lutAddressBits )
+    {
+        if ( lutAddressBits < 2 || lutAddressBits > 24 )
+            throw std::invalid_argument{ "DdsChirpGenerator lutAddressBits must be in the range 2 to 24" };
+    }
+}
+
+DdsChirpGenerator::DdsChirpGenerator( unsigned lutAddressBits, unsigned amplitudeBits, bool interpolate )
+  : pTable{ nullptr }
+  , addressBits{ lutAddressBits }
+  , fullScale{}
+  , interpolate{ interpolate }
+  , phaseAccumulator{}
+  , frequencyAccumulator{}
+  , frequencyStep{}
+  , sampleCounter{}
+{
+    validateAddressBits( lutAddressBits );
+    if ( amplitudeBits < 2 || amplitudeBits > 31 )
+        throw std::invalid_argument{ "DdsChirpGenerator amplitudeBits must be in the range 2 to 31" };
+
+    fullScale = int32_t( ( uint32_t( 1 ) << ( amplitudeBits - 1 ) ) - 1 );
+
+    const size_t tableSize = size_t( 1 ) << addressBits;
+    pTable = new int32_t[ tableSize ];
+    for ( size_t k = 0; tableSize != k; ++k )
+        pTable[k] = int32_t( std::lround( std::cos( twoPi * double( k ) / double( tableSize ) ) * fullScale ) );
+}
+
+DdsChirpGenerator::DdsChirpGenerator( const int32_t * pCosTable, unsigned lutAddressBits, int32_t fullScale,
+                                      bool interpolate )
+  : pTable{ nullptr }
+  , addressBits{ lutAddressBits }
+  , fullScale{ fullScale }
+  , interpolate{ interpolate }
+  , phaseAccumulator{}
+  , frequencyAccumulator{}
+  , frequencyStep{}
+  , sampleCounter{}
+{
+    validateAddressBits( lutAddressBits );
+    if ( fullScale <= 0 )
+        throw std::invalid_argument{ "DdsChirpGenerator fullScale must be positive" };
+
+    const size_t tableSize = size_t( 1 ) << addressBits;
+    pTable = new int32_t[ tableSize ];
+    std::memcpy( pTable, pCosTable, tableSize * sizeof( int32_t ) );
+}
+
+DdsChirpGenerator::~DdsChirpGenerator()
+{
+    delete[] pTable;
+}
+
+uint64_t DdsChirpGenerator::radiansToWord( double radians )
+{
+    // Reduce to a fraction of a turn in the interval [-0.5, 0.5] and scale by 2^64.
+    const auto turns = radians / twoPi;
+    auto scaled = std::ldexp( turns - std::nearbyint( turns ), 64 );
+
+    // A half turn either way is the same angle. Keep it representable as a signed 64 bit value.
+    if ( scaled >= 9223372036854775808.0 ) scaled = -9223372036854775808.0;
+
+    return static_cast< uint64_t >( static_cast< int64_t >( std::llround( scaled ) ) );
+}
+
+DdsChirpGenerator::TuningWords DdsChirpGenerator::tuningWordsFor( double accel, double omegaZero, double phi )
+{
+    // As with the ChirpingPhasorToneGenerator, the first phase advance is omegaZero plus half of accel.
+    // With the phase accumulator advanced by the frequency accumulator, and the frequency accumulator
+    // advanced by the step, this realizes, theta(n) = phi + omegaZero * n + 0.5 * accel * n^2.
+    // Half of the step word is taken with an arithmetic shift (floor) exactly as hardware would.
+    const auto step = radiansToWord( accel );
+    const auto halfStep = static_cast< uint64_t >( static_cast< int64_t >( step ) >> 1 );
+    return TuningWords{ radiansToWord( phi ), radiansToWord( omegaZero ) + halfStep, step };
+}
+
+void DdsChirpGenerator::reset( const TuningWords & words )
+{
+    phaseAccumulator = words.phase;
+    frequencyAccumulator = words.frequency;
+    frequencyStep = words.frequencyStep;
+    sampleCounter = 0;
+}
+
+void DdsChirpGenerator::reset( double accel, double omegaZero, double phi )
+{
+    reset( tuningWordsFor( accel, omegaZero, phi ) );
+}
+
+void DdsChirpGenerator::getSamples( Sample * pBuffer, size_t numSamples )
+{
+    while ( numSamples )
+    {
+        const auto count = numSamples < blockSize ? numSamples : blockSize;
+        generateBlock( pBuffer, count );
+        pBuffer += count;
+        numSamples -= count;
+    }
+}
+
+void DdsChirpGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    const auto scale = 1.0 / double( fullScale );
+    Sample block[ blockSize ];
+    while ( numSamples )
+    {
+        const auto count = numSamples < blockSize ? numSamples : blockSize;
+        generateBlock( block, count );
+        for ( size_t k = 0; count != k; ++k )
+            *pElementBuffer++ = FlyingPhasorElementType{ block[k].i * scale, block[k].q * scale };
+        numSamples -= count;
+    }
+}
+
+void DdsChirpGenerator::generateBlock( Sample * pBuffer, size_t numSamples )
+{
+    // The serial part. Unsigned arithmetic wraps modulo 2^64 exactly as the hardware accumulators do.
+    uint64_t phases[ blockSize ];
+    for ( size_t k = 0; numSamples != k; ++k )
+    {
+        phases[k] = phaseAccumulator;
+        phaseAccumulator += frequencyAccumulator;
+        frequencyAccumulator += frequencyStep;
+    }
+    sampleCounter += numSamples;
+
+    // The parallel part. Each iteration is independent of the others.
+    const auto pTab = pTable;
+    const uint64_t addressShift = 64 - addressBits;
+    const uint64_t addressMask = ( uint64_t( 1 ) << addressBits ) - 1;
+    const uint64_t quarterTurn = uint64_t( 1 ) << ( addressBits - 2 );
+    if ( !interpolate )
+    {
+        for ( size_t k = 0; numSamples != k; ++k )
+        {
+            const auto index = phases[k] >> addressShift;
+            pBuffer[k].i = pTab[ index ];
+            pBuffer[k].q = pTab[ ( index - quarterTurn ) & addressMask ];
+        }
+    }
+    else
+    {
+        // The interpolation fraction is taken from the bits immediately below the address bits.
+        // Products are formed in 64 bits and scaled back with an arithmetic shift.
+        const uint64_t fractionShift = addressShift - interpolationBits;
+        const uint64_t fractionMask = ( uint64_t( 1 ) << interpolationBits ) - 1;
+        for ( size_t k = 0; numSamples != k; ++k )
+        {
+            const auto index = phases[k] >> addressShift;
+            const auto fraction = int64_t( ( phases[k] >> fractionShift ) & fractionMask );
+            const auto sinIndex = ( index - quarterTurn ) & addressMask;
+
+            const int64_t cosA = pTab[ index ];
+            const int64_t cosB = pTab[ ( index + 1 ) & addressMask ];
+            const int64_t sinA = pTab[ sinIndex ];
+            const int64_t sinB = pTab[ ( sinIndex + 1 ) & addressMask ];
+
+            pBuffer[k].i = int32_t( cosA + ( ( ( cosB - cosA ) * fraction ) >> interpolationBits ) );
+            pBuffer[k].q = int32_t( sinA + ( ( ( sinB - sinA ) * fraction ) >> interpolationBits ) );
+        }
+    }
+}
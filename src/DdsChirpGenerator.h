@@ -0,0 +1,233 @@
+/**
+ * @file DdsChirpGenerator.h
+ * @brief The specification file for the Direct Digital Synthesis (DDS) Chirp Generator.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_DDSCHIRPGENERATOR_H
+#define REISER_RT_DDSCHIRPGENERATOR_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief DDS Chirp Generator
+         *
+         * This class provides a bit exact, integer phase accumulator implementation of a linear chirp, as
+         * would be implemented in hardware (e.g., an FPGA). It is intended to serve as a software reference
+         * for such hardware rather than as a replacement for the ChirpingPhasorToneGenerator, whose
+         * floating point recursion is far more accurate but cannot be bit exact.
+         *
+         * A 64 bit phase accumulator is advanced by a 64 bit frequency accumulator which is, in turn,
+         * advanced by a constant 64 bit frequency step word (the acceleration). A full turn of phase
+         * corresponds to 2^64. The most significant bits of the phase accumulator address a cosine lookup
+         * table of 2^N entries. The sine is obtained from the same table, a quarter turn away.
+         * Optionally, the next least significant bits of phase linearly interpolate between table entries.
+         * All post-table arithmetic is integer, so given the same table, output is identical on every platform.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT DdsChirpGenerator
+        {
+        public:
+            /**
+             * @brief DDS Sample Type
+             *
+             * An integer in-phase and quadrature sample pair.
+             */
+            struct Sample
+            {
+                int32_t i;  //!< In-phase (cosine) component.
+                int32_t q;  //!< Quadrature (sine) component.
+            };
+
+            /**
+             * @brief Tuning Words
+             *
+             * The initial accumulator contents, exactly as they would be programmed into hardware.
+             * Angles are expressed as fractions of a full turn, scaled by 2^64, in two's complement.
+             */
+            struct TuningWords
+            {
+                uint64_t phase;         //!< Initial phase accumulator, phi.
+                uint64_t frequency;     //!< Initial frequency accumulator, omegaZero plus half of accel.
+                uint64_t frequencyStep; //!< Frequency step word, accel.
+            };
+
+            /**
+             * @brief Number of Interpolation Fraction Bits
+             *
+             * The number of phase accumulator bits, below the table address bits, used for linear interpolation.
+             */
+            static constexpr unsigned interpolationBits = 16;
+
+            /**
+             * @brief Constructor
+             *
+             * Constructs a DDS Chirp Generator with an internally computed cosine table.
+             * The table entries are the rounded values of cosine scaled by 2^(amplitudeBits-1) - 1.
+             * These entries are computed with std::cos and, as such, could conceivably differ on a platform
+             * by a least significant bit for an entry that falls on a rounding boundary. Use the table supplying
+             * constructor to match hardware ROM contents exactly.
+             *
+             * @param lutAddressBits The number of table address bits. The table holds 2^lutAddressBits entries.
+             * Valid range is 2 to 24.
+             * @param amplitudeBits The number of output bits including sign. Valid range is 2 to 31.
+             * @param interpolate Enables linear interpolation between table entries.
+             *
+             * @throw Throws std::invalid_argument if either bit count is out of range.
+             */
+            explicit DdsChirpGenerator( unsigned lutAddressBits=12, unsigned amplitudeBits=16, bool interpolate=false );
+
+            /**
+             * @brief Table Supplying Constructor
+             *
+             * Constructs a DDS Chirp Generator from a user supplied cosine table which is copied.
+             *
+             * @param pCosTable A full turn cosine table of 2^lutAddressBits entries.
+             * @param lutAddressBits The number of table address bits. Valid range is 2 to 24.
+             * @param fullScale The table value representing unity magnitude, used for scaled output.
+             * @param interpolate Enables linear interpolation between table entries.
+             *
+             * @throw Throws std::invalid_argument if lutAddressBits is out of range or fullScale is not positive.
+             */
+            DdsChirpGenerator( const int32_t * pCosTable, unsigned lutAddressBits, int32_t fullScale, bool interpolate );
+
+            /**
+             * @brief Destructor
+             */
+            ~DdsChirpGenerator();
+
+            DdsChirpGenerator( const DdsChirpGenerator & another ) = delete;
+            DdsChirpGenerator & operator=( const DdsChirpGenerator & another ) = delete;
+
+            /**
+             * @brief Radians to Word Conversion
+             *
+             * Converts an angle in radians to a 64 bit two's complement fraction of a full turn.
+             * The conversion is performed in double precision and so resolves roughly 53 significant bits.
+             *
+             * @param radians The angle to be converted.
+             *
+             * @return Returns the equivalent turn fraction word.
+             */
+            static uint64_t radiansToWord( double radians );
+
+            /**
+             * @brief Tuning Words For
+             *
+             * Computes the tuning words realizing, theta(n) = phi + omegaZero * n + 0.5 * accel * n^2.
+             *
+             * @param accel Acceleration in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity in radians per sample.
+             * @param phi Starting phase angle in radians.
+             *
+             * @return Returns the tuning words.
+             */
+            static TuningWords tuningWordsFor( double accel, double omegaZero, double phi );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Loads the accumulators from tuning words and zeroes the sample counter.
+             *
+             * @param words The tuning words to load.
+             */
+            void reset( const TuningWords & words );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Loads the accumulators from the tuning words computed for the given parameters
+             * and zeroes the sample counter.
+             *
+             * @param accel Acceleration in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity in radians per sample.
+             * @param phi Starting phase angle in radians.
+             */
+            void reset( double accel=0.0, double omegaZero=0.0, double phi=0.0 );
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' integer samples into the user provided buffer.
+             *
+             * @param pBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( Sample * pBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' samples into the user provided buffer, scaled such that full scale has a magnitude of one.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Phase Accumulator
+             *
+             * @return Returns the phase accumulator contents for the next sample.
+             */
+            inline uint64_t getPhaseAccumulator() const { return phaseAccumulator; }
+
+            /**
+             * @brief Get Frequency Accumulator
+             *
+             * @return Returns the frequency accumulator contents for the next sample.
+             */
+            inline uint64_t getFrequencyAccumulator() const { return frequencyAccumulator; }
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @return Returns the number of samples delivered since construction or reset.
+             */
+            inline size_t getSampleCount() const { return sampleCounter; }
+
+            /**
+             * @brief Get Full Scale
+             *
+             * @return Returns the table value representing unity magnitude.
+             */
+            inline int32_t getFullScale() const { return fullScale; }
+
+        private:
+            /**
+             * @brief Block Size
+             *
+             * Samples are generated in blocks. First the (inherently serial) accumulator updates are run for
+             * a block, then the (independent and vectorizable) table lookups.
+             */
+            static constexpr size_t blockSize = 64;
+
+            /**
+             * @brief The Generate Block Operation
+             *
+             * Generates up to blockSize samples.
+             */
+            void generateBlock( Sample * pBuffer, size_t numSamples );
+
+        private:
+            int32_t * pTable;                   //!< The cosine lookup table.
+            unsigned addressBits;               //!< The number of table address bits.
+            int32_t fullScale;                  //!< The table value representing unity magnitude.
+            bool interpolate;                   //!< Whether linear interpolation is enabled.
+            uint64_t phaseAccumulator;          //!< Phase of the next sample.
+            uint64_t frequencyAccumulator;      //!< Phase advance to the sample after next.
+            uint64_t frequencyStep;             //!< Frequency accumulator advance per sample.
+            size_t sampleCounter;               //!< Number of samples delivered.
+        };
+    }
+}
+
+#endif //REISER_RT_DDSCHIRPGENERATOR_H
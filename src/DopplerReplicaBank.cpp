@@ -0,0 +1,180 @@
+/**
+ * @file DopplerReplicaBank.cpp
+ * @brief The implementation file for the Doppler Replica Bank.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "DopplerReplicaBank.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class DopplerReplicaBank::Imple
+{
+public:
+    // Number of base chirp samples generated per block. Kept small enough for the base block to remain in L1.
+    static constexpr size_t blockSize = 256;
+
+    // Number of independent lanes each replica's offset phasor is split into.
+    static constexpr size_t numLanes = 4;
+
+    Imple( double theAccel, double theOmegaZero, double thePhi, const double * pDopplerOffsets, size_t numReplicas )
+      : accel{ theAccel }
+      , omegaZero{ theOmegaZero }
+      , phi{ thePhi }
+      , replicas( numReplicas )
+    {
+        for ( size_t m = 0; numReplicas != m; ++m )
+        {
+            auto & replica = replicas[m];
+            for ( size_t j = 0; numLanes != j; ++j )
+            {
+                replica.powRe[j] = std::cos( pDopplerOffsets[m] * double( j ) );
+                replica.powIm[j] = std::sin( pDopplerOffsets[m] * double( j ) );
+            }
+            replica.stepRe = std::cos( pDopplerOffsets[m] * double( numLanes ) );
+            replica.stepIm = std::sin( pDopplerOffsets[m] * double( numLanes ) );
+        }
+        reset();
+    }
+
+    void reset()
+    {
+        base.reset( accel, omegaZero, phi );
+        for ( auto & replica : replicas )
+        {
+            replica.phasorRe = 1.0;
+            replica.phasorIm = 0.0;
+        }
+        sampleCount = 0;
+    }
+
+    void getSamples( FlyingPhasorElementBufferTypePtr pOut, size_t numSamples )
+    {
+        for ( size_t n0 = 0; numSamples != n0; )
+        {
+            const auto count = std::min( blockSize, numSamples - n0 );
+
+            // The one and only chirp recursion for this block, split into real and imaginary parts.
+            base.getSamples( baseBlock, count );
+            for ( size_t n = 0; count != n; ++n )
+            {
+                baseRe[n] = baseBlock[n].real();
+                baseIm[n] = baseBlock[n].imag();
+            }
+
+            for ( size_t m = 0; replicas.size() != m; ++m )
+            {
+                auto & replica = replicas[m];
+                auto pDst = pOut + m * numSamples + n0;
+
+                // Build lanes from the replica's phasor. Lane j holds the phasor for samples n + j.
+                double laneRe[ numLanes ];
+                double laneIm[ numLanes ];
+                for ( size_t j = 0; numLanes != j; ++j )
+                {
+                    laneRe[j] = replica.phasorRe * replica.powRe[j] - replica.phasorIm * replica.powIm[j];
+                    laneIm[j] = replica.phasorRe * replica.powIm[j] + replica.phasorIm * replica.powRe[j];
+                }
+
+                // The fused inner loop.
+                const auto stepRe = replica.stepRe;
+                const auto stepIm = replica.stepIm;
+                size_t n = 0;
+                for ( ; n + numLanes <= count; n += numLanes )
+                {
+                    for ( size_t j = 0; numLanes != j; ++j )
+                    {
+                        const auto br = baseRe[ n + j ];
+                        const auto bi = baseIm[ n + j ];
+                        pDst[ n + j ] = FlyingPhasorElementType{ br * laneRe[j] - bi * laneIm[j],
+                                                                 br * laneIm[j] + bi * laneRe[j] };
+                        const auto re = laneRe[j] * stepRe - laneIm[j] * stepIm;
+                        laneIm[j] = laneRe[j] * stepIm + laneIm[j] * stepRe;
+                        laneRe[j] = re;
+                    }
+                }
+
+                // Any remainder is taken from the lanes without advancing them. The phasor for the
+                // first sample of the next block is then the lane following the remainder.
+                const auto remainder = count - n;
+                for ( size_t j = 0; remainder != j; ++j )
+                {
+                    const auto br = baseRe[ n + j ];
+                    const auto bi = baseIm[ n + j ];
+                    pDst[ n + j ] = FlyingPhasorElementType{ br * laneRe[j] - bi * laneIm[j],
+                                                             br * laneIm[j] + bi * laneRe[j] };
+                }
+                replica.phasorRe = laneRe[ remainder ];
+                replica.phasorIm = laneIm[ remainder ];
+
+                // Re-normalize once per block with a first order Taylor Series approximation of the square root.
+                const auto d = 1.0 - ( replica.phasorRe * replica.phasorRe + replica.phasorIm * replica.phasorIm - 1.0 ) / 2.0;
+                replica.phasorRe *= d;
+                replica.phasorIm *= d;
+            }
+
+            n0 += count;
+            sampleCount += count;
+        }
+    }
+
+    struct Replica
+    {
+        double phasorRe;            // Offset phasor for the next sample.
+        double phasorIm;
+        double powRe[ numLanes ];   // Offset rotation to the powers 0 through numLanes - 1.
+        double powIm[ numLanes ];
+        double stepRe;              // Offset rotation to the power numLanes.
+        double stepIm;
+    };
+
+    const double accel;
+    const double omegaZero;
+    const double phi;
+    std::vector< Replica > replicas;
+    ChirpingPhasorToneGenerator base{};
+    FlyingPhasorElementType baseBlock[ blockSize ];
+    double baseRe[ blockSize ];
+    double baseIm[ blockSize ];
+    size_t sampleCount{};
+};
+
+constexpr size_t DopplerReplicaBank::Imple::blockSize;
+constexpr size_t DopplerReplicaBank::Imple::numLanes;
+
+DopplerReplicaBank::DopplerReplicaBank( double accel, double omegaZero, double phi,
+                                        const double * pDopplerOffsets, size_t numReplicas )
+  : pImple{ new Imple{ accel, omegaZero, phi, pDopplerOffsets, numReplicas } }
+{
+}
+
+DopplerReplicaBank::~DopplerReplicaBank()
+{
+    delete pImple;
+}
+
+void DopplerReplicaBank::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->getSamples( pElementBuffer, numSamples );
+}
+
+void DopplerReplicaBank::reset()
+{
+    pImple->reset();
+}
+
+size_t DopplerReplicaBank::getNumReplicas() const
+{
+    return pImple->replicas.size();
+}
+
+size_t DopplerReplicaBank::getSampleCount() const
+{
+    return pImple->sampleCount;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file DopplerReplicaBank.h
+ * @brief The specification file for the Doppler Replica Bank.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_DOPPLERREPLICABANK_H
+#define REISER_RT_DOPPLERREPLICABANK_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Doppler Replica Bank
+         *
+         * This class produces M Doppler shifted replicas of a chirp from a single chirp recursion.
+         * A replica shifted by omegaD radians per sample is identical to a chirp with a starting angular
+         * velocity of omegaZero + omegaD. Rather than running M ChirpingPhasorToneGenerator instances,
+         * the base chirp is generated once per block and each replica is obtained by multiplying it with a
+         * FlyingPhasorToneGenerator style frequency offset phasor.
+         *
+         * The offset phasors are advanced in four independent lanes, each stepping four samples at a time,
+         * so the fused inner loop carries no serial dependency from one sample to the next and vectorizes.
+         * The lanes are rebuilt from a single re-normalized phasor per replica at every block.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT DopplerReplicaBank
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Constructor
+             *
+             * @param accel Acceleration in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity in radians per sample.
+             * @param phi Starting phase angle in radians.
+             * @param pDopplerOffsets Array of Doppler offsets in radians per sample, copied.
+             * @param numReplicas Number of replicas (Doppler offsets).
+             */
+            DopplerReplicaBank( double accel, double omegaZero, double phi,
+                                const double * pDopplerOffsets, size_t numReplicas );
+
+            /**
+             * @brief Destructor
+             */
+            ~DopplerReplicaBank();
+
+            DopplerReplicaBank( const DopplerReplicaBank & another ) = delete;
+            DopplerReplicaBank & operator=( const DopplerReplicaBank & another ) = delete;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' samples of every replica into the user provided buffer. Each replica's samples are
+             * contiguous, pElementBuffer[ replica * numSamples + sample ]. Subsequent invocations continue on in
+             * phase with those previous.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold numSamples times the number
+             * of replicas.
+             * @param numSamples The number of samples per replica to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Restarts every replica from sample zero.
+             */
+            void reset();
+
+            /**
+             * @brief Get Number of Replicas
+             *
+             * @return Returns the number of replicas.
+             */
+            size_t getNumReplicas() const;
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @return Returns the number of samples delivered per replica since construction or reset.
+             */
+            size_t getSampleCount() const;
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_DOPPLERREPLICABANK_H
@@ -0,0 +1,133 @@
+/**
+ * @file FmcwBeatSignalSynthesizer.cpp
+ * @brief The implementation file for the FMCW Beat Signal Synthesizer.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "FmcwBeatSignalSynthesizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class FmcwBeatSignalSynthesizer::Imple
+{
+public:
+    // The number of IF samples per block. 16 KiB of samples fits in L1 cache.
+    static constexpr size_t blockSize = 1024;
+
+    Imple( double theAccel, double theOmegaZero, size_t theDecimation, const Target * pTargets, size_t numTargets )
+      : accel{ theAccel }
+      , omegaZero{ theOmegaZero }
+      , decimation{ theDecimation }
+      , block( blockSize )
+      , sampleCounter{}
+    {
+        if ( 0 == decimation )
+            throw std::invalid_argument{ "FmcwBeatSignalSynthesizer decimation must be non-zero" };
+        setTargets( pTargets, numTargets );
+    }
+
+    void setTargets( const Target * pTargets, size_t numTargets )
+    {
+        targets.assign( pTargets, pTargets + numTargets );
+        tones.assign( numTargets, FlyingPhasorToneGenerator{} );
+        firstSamples.assign( numTargets, 0 );
+        reset();
+    }
+
+    void reset()
+    {
+        const auto d = static_cast< double >( decimation );
+        for ( size_t i = 0; targets.size() != i; ++i )
+        {
+            const auto & target = targets[i];
+            const auto tau = target.delay;
+
+            // The first IF sample at which the echo has arrived, k * decimation >= delay.
+            const auto first = tau > 0.0 ? static_cast< size_t >( std::ceil( tau / d ) ) : size_t( 0 );
+            firstSamples[i] = first;
+
+            // The beat tone, seeded with its phase at that first IF sample.
+            const auto omegaBeat = target.doppler - accel * tau;
+            const auto n = static_cast< double >( first ) * d;
+            const auto phase = omegaBeat * n - omegaZero * tau + 0.5 * accel * tau * tau;
+            tones[i].reset( std::remainder( omegaBeat * d, 2.0 * M_PI ), std::remainder( phase, 2.0 * M_PI ) );
+        }
+        sampleCounter = 0;
+    }
+
+    void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+    {
+        while ( numSamples )
+        {
+            const auto count = numSamples < blockSize ? numSamples : blockSize;
+            std::fill( pElementBuffer, pElementBuffer + count, FlyingPhasorElementType{} );
+
+            // Every target accumulates into the block while it remains cache resident.
+            const auto k0 = sampleCounter;
+            const auto k1 = sampleCounter + count;
+            for ( size_t i = 0; targets.size() != i; ++i )
+            {
+                if ( firstSamples[i] >= k1 ) continue;
+                const auto offset = firstSamples[i] > k0 ? firstSamples[i] - k0 : size_t( 0 );
+                const auto active = count - offset;
+                tones[i].getSamples( block.data(), active );
+                const auto amplitude = targets[i].amplitude;
+                auto pOut = pElementBuffer + offset;
+                for ( size_t n = 0; active != n; ++n )
+                    pOut[n] += amplitude * block[n];
+            }
+
+            pElementBuffer += count;
+            numSamples -= count;
+            sampleCounter += count;
+        }
+    }
+
+    const double accel;
+    const double omegaZero;
+    const size_t decimation;
+    std::vector< Target > targets;
+    std::vector< FlyingPhasorToneGenerator > tones;
+    std::vector< size_t > firstSamples;
+    std::vector< FlyingPhasorElementType > block;
+    size_t sampleCounter;
+};
+
+constexpr size_t FmcwBeatSignalSynthesizer::Imple::blockSize;
+
+FmcwBeatSignalSynthesizer::FmcwBeatSignalSynthesizer( double accel, double omegaZero, size_t decimation,
+                                                      const Target * pTargets, size_t numTargets )
+  : pImple{ new Imple{ accel, omegaZero, decimation, pTargets, numTargets } }
+{
+}
+
+FmcwBeatSignalSynthesizer::~FmcwBeatSignalSynthesizer()
+{
+    delete pImple;
+}
+
+void FmcwBeatSignalSynthesizer::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->getSamples( pElementBuffer, numSamples );
+}
+
+void FmcwBeatSignalSynthesizer::setTargets( const Target * pTargets, size_t numTargets )
+{
+    pImple->setTargets( pTargets, numTargets );
+}
+
+void FmcwBeatSignalSynthesizer::reset()
+{
+    pImple->reset();
+}
+
+size_t FmcwBeatSignalSynthesizer::getSampleCount() const
+{
+    return pImple->sampleCounter;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file FmcwBeatSignalSynthesizer.h
+ * @brief The specification file for the FMCW Beat Signal Synthesizer.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_FMCWBEATSIGNALSYNTHESIZER_H
+#define REISER_RT_FMCWBEATSIGNALSYNTHESIZER_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief FMCW Beat Signal Synthesizer
+         *
+         * This class produces the dechirped (beat, or IF) signal of an FMCW receiver directly at the IF sample
+         * rate, without generating the full rate transmit chirp or its echoes. The transmit chirp has phase,
+         * theta(n) = phi + omegaZero * n + 0.5 * accel * n^2, and a target echo is,
+         * amplitude * tx( n - delay ) * exp( j * omegaD * n ). After dechirp, echo times the conjugate of the
+         * transmit chirp, each target is simply a tone,
+         * amplitude * exp( j * ( ( omegaD - accel * delay ) * n - omegaZero * delay + 0.5 * accel * delay^2 ) ),
+         * where the final term is the residual video phase. The transmit phase phi cancels.
+         *
+         * Each target's tone is produced by a FlyingPhasorToneGenerator running at the IF sample rate,
+         * one IF sample every `decimation` full rate samples. Tones are summed a cache sized block at a time.
+         * A target contributes nothing before its echo arrives, n < delay. The dechirped signal is sampled
+         * ideally, as if by a perfect anti-alias filter, so beat frequencies must lie within the IF Nyquist band
+         * to be meaningful.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT FmcwBeatSignalSynthesizer
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Target
+             *
+             * The description of a point scatterer.
+             */
+            struct Target
+            {
+                double delay;                           //!< Round trip delay in full rate samples.
+                double doppler;                         //!< Doppler shift in radians per full rate sample.
+                FlyingPhasorElementType amplitude;      //!< Complex amplitude of the echo.
+            };
+
+            /**
+             * @brief Constructor
+             *
+             * @param accel Acceleration of the transmit chirp in radians per sample, per sample (full rate).
+             * @param omegaZero Starting angular velocity of the transmit chirp in radians per sample (full rate).
+             * @param decimation The number of full rate samples per IF sample.
+             * @param pTargets Array of targets, copied.
+             * @param numTargets Number of targets.
+             *
+             * @throw Throws std::invalid_argument if decimation is zero.
+             */
+            FmcwBeatSignalSynthesizer( double accel, double omegaZero, size_t decimation,
+                                       const Target * pTargets, size_t numTargets );
+
+            /**
+             * @brief Destructor
+             */
+            ~FmcwBeatSignalSynthesizer();
+
+            FmcwBeatSignalSynthesizer( const FmcwBeatSignalSynthesizer & another ) = delete;
+            FmcwBeatSignalSynthesizer & operator=( const FmcwBeatSignalSynthesizer & another ) = delete;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Delivers 'N' IF samples of the summed beat signal into the user provided buffer, overwriting it.
+             * Subsequent invocations continue on in phase with those previous.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of IF samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Set Targets Operation
+             *
+             * Replaces the target list and restarts from the beginning of the sweep.
+             *
+             * @param pTargets Array of targets, copied.
+             * @param numTargets Number of targets.
+             */
+            void setTargets( const Target * pTargets, size_t numTargets );
+
+            /**
+             * @brief Reset Operation
+             *
+             * Restarts from the beginning of the sweep, IF sample zero.
+             */
+            void reset();
+
+            /**
+             * @brief Get Sample Counter
+             *
+             * @return Returns the number of IF samples delivered since construction or reset.
+             */
+            size_t getSampleCount() const;
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_FMCWBEATSIGNALSYNTHESIZER_H
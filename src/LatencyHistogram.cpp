@@ -0,0 +1,93 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief The implementation file for the Latency Histogram.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+
+using namespace ReiserRT::Signal;
+
+constexpr unsigned LatencyHistogram::subBucketBits;
+constexpr size_t LatencyHistogram::subBucketCount;
+constexpr size_t LatencyHistogram::bucketCount;
+
+LatencyHistogram::LatencyHistogram()
+  : counts{}
+  , count{}
+  , sum{}
+  , minValue{ std::numeric_limits< uint64_t >::max() }
+  , maxValue{}
+{
+}
+
+void LatencyHistogram::merge( const LatencyHistogram & another )
+{
+    for ( size_t i = 0; bucketCount != i; ++i )
+        counts[i] += another.counts[i];
+    count += another.count;
+    sum += another.sum;
+    minValue = std::min( minValue, another.minValue );
+    maxValue = std::max( maxValue, another.maxValue );
+}
+
+void LatencyHistogram::clear()
+{
+    std::fill( counts, counts + bucketCount, uint64_t{} );
+    count = 0;
+    sum = 0;
+    minValue = std::numeric_limits< uint64_t >::max();
+    maxValue = 0;
+}
+
+double LatencyHistogram::getMean() const
+{
+    return count ? double( sum ) / double( count ) : 0.0;
+}
+
+uint64_t LatencyHistogram::valueAtPercentile( double percentile ) const
+{
+    if ( !count ) return 0;
+
+    // The rank of the percentile, one based and rounded to nearest, as a percentage such as 99.9 is not exactly
+    // representable. At least the first recording is always included.
+    const auto p = std::min( 100.0, std::max( 0.0, percentile ) );
+    auto rank = uint64_t( p / 100.0 * double( count ) + 0.5 );
+    if ( rank < 1 ) rank = 1;
+    if ( rank > count ) rank = count;
+
+    uint64_t cumulative = 0;
+    for ( size_t i = 0; bucketCount != i; ++i )
+    {
+        cumulative += counts[i];
+        if ( cumulative >= rank )
+            return std::min( bucketHighestValue( i ), maxValue );
+    }
+    return maxValue;
+}
+
+void LatencyHistogram::report( std::ostream & os, const char * label ) const
+{
+    os << label << ": count=" << count
+       << " min=" << getMin()
+       << " mean=" << uint64_t( getMean() + 0.5 )
+       << " p50=" << valueAtPercentile( 50.0 )
+       << " p99=" << valueAtPercentile( 99.0 )
+       << " p99.9=" << valueAtPercentile( 99.9 )
+       << " max=" << getMax() << " (ns)" << std::endl;
+}
+
+uint64_t LatencyHistogram::bucketHighestValue( size_t index )
+{
+    if ( index < subBucketCount ) return uint64_t( index );
+
+    // Buckets above the exact range each span 2^shift values, beginning at ( subBucketCount + sub ) << shift.
+    const auto shift = unsigned( index / subBucketCount - 1 );
+    const auto sub = uint64_t( index % subBucketCount );
+    return ( ( subBucketCount + sub ) << shift ) + ( ( uint64_t( 1 ) << shift ) - 1 );
+}
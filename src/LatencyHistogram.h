@@ -0,0 +1,225 @@
+/**
+ * @file LatencyHistogram.h
+ * @brief The specification file for the Latency Histogram.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_LATENCYHISTOGRAM_H
+#define REISER_RT_LATENCYHISTOGRAM_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Latency Histogram
+         *
+         * This class records latencies in nanoseconds into a log bucketed (HDR style) histogram. Each power of two
+         * is divided into 2^subBucketBits linear sub buckets, so any recorded value is resolved to within
+         * 1 / 2^subBucketBits (about 3%) of itself, over the entire 64 bit range, with a fixed amount of memory.
+         * Values below 2^subBucketBits are resolved exactly. Recording is a handful of integer operations with
+         * no allocation, suitable for use within a real-time loop.
+         *
+         * It is intended to reveal worst case behavior, page faults, denormal slowdowns or frequency scaling for
+         * example, that averages hide. Percentiles are reported as the highest value equivalent to the bucket in
+         * which they fall, never exceeding the maximum value recorded.
+         *
+         * As with the tone generators, instances are not thread safe. Threads should record into their own instances,
+         * which may later be merged.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT LatencyHistogram
+        {
+        public:
+            /**
+             * @brief The number of bits of sub bucket resolution within each power of two.
+             */
+            static constexpr unsigned subBucketBits = 5;
+
+            /**
+             * @brief The number of sub buckets within each power of two.
+             */
+            static constexpr size_t subBucketCount = size_t( 1 ) << subBucketBits;
+
+            /**
+             * @brief The total number of buckets, covering the entire 64 bit range.
+             */
+            static constexpr size_t bucketCount = ( 64 - subBucketBits + 1 ) * subBucketCount;
+
+            /**
+             * @brief Default Constructor
+             *
+             * Constructs an empty histogram.
+             */
+            LatencyHistogram();
+
+            /**
+             * @brief Record Operation
+             *
+             * @param nanoseconds The latency to be recorded.
+             */
+            inline void record( uint64_t nanoseconds )
+            {
+                ++counts[ bucketIndex( nanoseconds ) ];
+                ++count;
+                sum += nanoseconds;
+                if ( nanoseconds < minValue ) minValue = nanoseconds;
+                if ( nanoseconds > maxValue ) maxValue = nanoseconds;
+            }
+
+            /**
+             * @brief Merge Operation
+             *
+             * Accumulates the recordings of another histogram into this histogram.
+             *
+             * @param another Another histogram.
+             */
+            void merge( const LatencyHistogram & another );
+
+            /**
+             * @brief Clear Operation
+             *
+             * Discards all recordings.
+             */
+            void clear();
+
+            /**
+             * @brief Get Count
+             *
+             * @return Returns the number of latencies recorded.
+             */
+            inline uint64_t getCount() const { return count; }
+
+            /**
+             * @brief Get Minimum
+             *
+             * @return Returns the minimum latency recorded, zero if none have been recorded.
+             */
+            inline uint64_t getMin() const { return count ? minValue : 0; }
+
+            /**
+             * @brief Get Maximum
+             *
+             * @return Returns the maximum latency recorded, zero if none have been recorded.
+             */
+            inline uint64_t getMax() const { return maxValue; }
+
+            /**
+             * @brief Get Mean
+             *
+             * @return Returns the mean latency recorded, zero if none have been recorded.
+             */
+            double getMean() const;
+
+            /**
+             * @brief Value at Percentile
+             *
+             * @param percentile The percentile of interest, in the interval [0, 100]. Values outside are clamped.
+             * @return Returns the highest value equivalent to the bucket in which the percentile falls,
+             * limited to the maximum recorded. Returns zero if none have been recorded.
+             */
+            uint64_t valueAtPercentile( double percentile ) const;
+
+            /**
+             * @brief Report Operation
+             *
+             * Writes a single line summary, the count, min, mean, p50, p99, p99.9 and max, to a stream.
+             *
+             * @param os The stream to write to.
+             * @param label A label to prefix the summary with.
+             */
+            void report( std::ostream & os, const char * label ) const;
+
+            /**
+             * @brief Bucket Index
+             *
+             * @param value A value.
+             * @return Returns the index of the bucket which the value is recorded in.
+             */
+            static inline size_t bucketIndex( uint64_t value )
+            {
+                if ( value < subBucketCount ) return size_t( value );
+
+                // The position of the most significant bit, by binary search. The value's exponent
+                // selects the power of two and the bits following the leading one select the sub bucket.
+                unsigned msb = 0;
+                for ( unsigned shift = 32; shift; shift >>= 1 )
+                    if ( value >> ( msb + shift ) ) msb += shift;
+                const auto shift = msb - subBucketBits;
+                return size_t( shift + 1 ) * subBucketCount + size_t( ( value >> shift ) & ( subBucketCount - 1 ) );
+            }
+
+            /**
+             * @brief Bucket Highest Value
+             *
+             * @param index A bucket index.
+             * @return Returns the highest value recorded in the bucket.
+             */
+            static uint64_t bucketHighestValue( size_t index );
+
+        private:
+            uint64_t counts[ bucketCount ];     //!< The count of each bucket.
+            uint64_t count;                     //!< The total count.
+            uint64_t sum;                       //!< The sum of all values, for the mean.
+            uint64_t minValue;                  //!< The minimum value recorded.
+            uint64_t maxValue;                  //!< The maximum value recorded.
+        };
+
+        /**
+         * @brief Scoped Latency Timer
+         *
+         * Records the time elapsed over its lifetime into a LatencyHistogram, with the steady clock. Placing one
+         * in the scope of a getSamples invocation, or of a chunk loop body, times it without touching the
+         * generation path itself. Timing is opt in. Given a null histogram, the clock is never read.
+         */
+        class ScopedLatencyTimer
+        {
+        public:
+            /**
+             * @brief Constructor
+             *
+             * @param pTheHistogram The histogram to record into upon destruction, or null to disable timing.
+             */
+            explicit ScopedLatencyTimer( LatencyHistogram * pTheHistogram )
+              : pHistogram( pTheHistogram )
+              , start{ pHistogram ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{} }
+            {
+            }
+
+            /**
+             * @brief Destructor
+             *
+             * Records the elapsed time.
+             */
+            ~ScopedLatencyTimer()
+            {
+                if ( !pHistogram ) return;
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                pHistogram->record( uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( elapsed ).count() ) );
+            }
+
+            /**
+             * @brief Copy Constructor Deleted
+             */
+            ScopedLatencyTimer( const ScopedLatencyTimer & ) = delete;
+
+            /**
+             * @brief Copy Assignment Deleted
+             */
+            ScopedLatencyTimer & operator=( const ScopedLatencyTimer & ) = delete;
+
+        private:
+            LatencyHistogram * pHistogram;                      //!< The histogram recorded into, if any.
+            std::chrono::steady_clock::time_point start;        //!< The time of construction.
+        };
+    }
+}
+
+#endif //REISER_RT_LATENCYHISTOGRAM_H
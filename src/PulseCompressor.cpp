@@ -0,0 +1,227 @@
+/**
+ * @file PulseCompressor.cpp
+ * @brief The implementation file for the Pulse Compressor.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "PulseCompressor.h"
+#include "ChirpingPhasorToneGenerator.h"
+#include "ThreadJoiner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    /**
+     * @brief An iterative, in place, radix-2 decimation in time forward FFT of a power of two size.
+     *
+     * The bit reversal permutation and twiddle factors are precomputed. Butterflies operate upon the real
+     * and imaginary parts directly, avoiding the special case handling of std::complex multiplication.
+     */
+    class Fft
+    {
+    public:
+        explicit Fft( size_t theSize )
+          : size{ theSize }
+          , twiddles( theSize / 2 )
+          , bitReversed( theSize )
+        {
+            unsigned log2Size = 0;
+            while ( ( size_t( 1 ) << log2Size ) < size ) ++log2Size;
+
+            for ( size_t i = 0; size != i; ++i )
+            {
+                size_t reversed = 0;
+                for ( unsigned b = 0; log2Size != b; ++b )
+                    if ( ( i >> b ) & 0x1 ) reversed |= size_t( 1 ) << ( log2Size - 1 - b );
+                bitReversed[i] = reversed;
+            }
+
+            for ( size_t k = 0; twiddles.size() != k; ++k )
+                twiddles[k] = std::polar( 1.0, -2.0 * M_PI * static_cast< double >( k ) / static_cast< double >( size ) );
+        }
+
+        void forward( FlyingPhasorElementBufferTypePtr pData ) const
+        {
+            for ( size_t i = 0; size != i; ++i )
+            {
+                const auto j = bitReversed[i];
+                if ( i < j ) std::swap( pData[i], pData[j] );
+            }
+
+            // std::complex< double > is layout compatible with an array of two doubles (real, imaginary).
+            auto p = reinterpret_cast< double * >( pData );
+            for ( size_t half = 1; size > half; half <<= 1 )
+            {
+                const auto stride = size / ( 2 * half );
+                for ( size_t k0 = 0; size != k0; k0 += 2 * half )
+                {
+                    for ( size_t j = 0; half != j; ++j )
+                    {
+                        const auto & w = twiddles[ j * stride ];
+                        const auto wr = w.real();
+                        const auto wi = w.imag();
+                        auto a = p + 2 * ( k0 + j );
+                        auto b = a + 2 * half;
+                        const auto br = b[0] * wr - b[1] * wi;
+                        const auto bi = b[0] * wi + b[1] * wr;
+                        b[0] = a[0] - br;
+                        b[1] = a[1] - bi;
+                        a[0] += br;
+                        a[1] += bi;
+                    }
+                }
+            }
+        }
+
+        const size_t size;                                          //!< The transform size, a power of two.
+
+    private:
+        std::vector< FlyingPhasorElementType > twiddles;            //!< exp( -j2(pi)k/size ) for k < size / 2.
+        std::vector< size_t > bitReversed;                          //!< The bit reversal permutation.
+    };
+
+    size_t selectFftSize( size_t pulseLength, size_t fftSize )
+    {
+        if ( !pulseLength )
+            throw std::invalid_argument{ "PulseCompressor pulse length must be nonzero" };
+
+        if ( !fftSize )
+        {
+            fftSize = 1;
+            while ( fftSize < 4 * pulseLength ) fftSize <<= 1;
+            return fftSize;
+        }
+
+        if ( ( fftSize & ( fftSize - 1 ) ) || fftSize < pulseLength )
+            throw std::invalid_argument{ "PulseCompressor FFT size must be a power of two of at least the pulse length" };
+        return fftSize;
+    }
+}
+
+class PulseCompressor::Imple
+{
+public:
+    Imple( const FlyingPhasorElementType * pReference, size_t thePulseLength, size_t theFftSize )
+      : pulseLength{ thePulseLength }
+      , fft{ selectFftSize( thePulseLength, theFftSize ) }
+      , spectrum( fft.size )
+    {
+        // The spectrum of the zero padded reference, with the inverse transform's scaling folded in.
+        std::copy( pReference, pReference + pulseLength, spectrum.begin() );
+        fft.forward( spectrum.data() );
+        const auto scale = 1.0 / static_cast< double >( fft.size );
+        for ( auto & s : spectrum ) s *= scale;
+    }
+
+    // Overlap-save. Each block of fft.size input samples yields the first fft.size - pulseLength + 1 lags
+    // of its circular correlation, which are free of wrap around. The correlation's spectrum is X * conj( R ).
+    // Its inverse transform is taken as the conjugate of the forward transform of the conjugate spectrum,
+    // conj( X ) * R, so only the forward transform is required.
+    void compress( const FlyingPhasorElementType * pInput, size_t numSamples,
+                   FlyingPhasorElementBufferTypePtr pOutput, FlyingPhasorElementBufferTypePtr pScratch ) const
+    {
+        const auto size = fft.size;
+        const auto step = size - pulseLength + 1;
+        for ( size_t n0 = 0; numSamples > n0; n0 += step )
+        {
+            const auto available = std::min( size, numSamples - n0 );
+            std::copy( pInput + n0, pInput + n0 + available, pScratch );
+            std::fill( pScratch + available, pScratch + size, FlyingPhasorElementType{} );
+
+            fft.forward( pScratch );
+            for ( size_t m = 0; size != m; ++m )
+            {
+                const auto x = pScratch[m];
+                const auto s = spectrum[m];
+                pScratch[m] = FlyingPhasorElementType{ x.real() * s.real() + x.imag() * s.imag(),
+                                                       x.real() * s.imag() - x.imag() * s.real() };
+            }
+            fft.forward( pScratch );
+
+            const auto count = std::min( step, numSamples - n0 );
+            for ( size_t i = 0; count != i; ++i )
+                pOutput[ n0 + i ] = std::conj( pScratch[i] );
+        }
+    }
+
+    const size_t pulseLength;                                   //!< The number of samples in the reference pulse.
+    const Fft fft;                                              //!< The transform.
+    std::vector< FlyingPhasorElementType > spectrum;            //!< The cached, scaled reference spectrum.
+};
+
+namespace
+{
+    std::vector< FlyingPhasorElementType > makeChirp( double accel, double omegaZero, double phi, size_t pulseLength )
+    {
+        std::vector< FlyingPhasorElementType > pulse( pulseLength );
+        ChirpingPhasorToneGenerator generator{ accel, omegaZero, phi };
+        generator.getSamples( pulse.data(), pulseLength );
+        return pulse;
+    }
+}
+
+PulseCompressor::PulseCompressor( double accel, double omegaZero, double phi, size_t pulseLength, size_t fftSize )
+  : pImple{ new Imple{ makeChirp( accel, omegaZero, phi, pulseLength ).data(), pulseLength, fftSize } }
+{
+}
+
+PulseCompressor::PulseCompressor( const FlyingPhasorElementType * pReference, size_t pulseLength, size_t fftSize )
+  : pImple{ new Imple{ pReference, pulseLength, fftSize } }
+{
+}
+
+PulseCompressor::~PulseCompressor()
+{
+    delete pImple;
+}
+
+void PulseCompressor::compress( const FlyingPhasorElementType * pInput, size_t numSamples,
+                                FlyingPhasorElementBufferTypePtr pOutput ) const
+{
+    std::vector< FlyingPhasorElementType > scratch( pImple->fft.size );
+    pImple->compress( pInput, numSamples, pOutput, scratch.data() );
+}
+
+void PulseCompressor::compressPulses( const FlyingPhasorElementType * pInput, FlyingPhasorElementBufferTypePtr pOutput,
+                                      size_t numPulses, size_t rangeGateLength, unsigned numThreads ) const
+{
+    const auto fftSize = pImple->fft.size;
+    auto work = [=]( size_t firstPulse, size_t stride ) {
+        std::vector< FlyingPhasorElementType > scratch( fftSize );
+        for ( size_t p = firstPulse; p < numPulses; p += stride )
+            pImple->compress( pInput + p * rangeGateLength, rangeGateLength, pOutput + p * rangeGateLength,
+                              scratch.data() );
+    };
+
+    if ( numThreads <= 1 || numPulses <= 1 )
+    {
+        work( 0, 1 );
+        return;
+    }
+
+    // Pulses are interleaved across threads. Each pulse is independent and written to its own range gate.
+    const auto stride = std::min< size_t >( numThreads, numPulses );
+    std::vector< std::thread > threads;
+    ThreadJoiner joiner{ threads };
+    for ( size_t t = 1; stride != t; ++t )
+        threads.emplace_back( work, t, stride );
+    work( 0, stride );
+}
+
+size_t PulseCompressor::getPulseLength() const
+{
+    return pImple->pulseLength;
+}
+
+size_t PulseCompressor::getFftSize() const
+{
+    return pImple->fft.size;
+}
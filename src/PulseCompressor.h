@@ -0,0 +1,134 @@
+/**
+ * @file PulseCompressor.h
+ * @brief The specification file for the Pulse Compressor.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_PULSECOMPRESSOR_H
+#define REISER_RT_PULSECOMPRESSOR_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Pulse Compressor
+         *
+         * This class performs pulse compression (matched filtering) of received data against a reference pulse,
+         * by fast convolution. The output at lag n is the correlation, sum over k of conj( ref(k) ) * x( n + k ),
+         * so that an echo delayed by d samples compresses to a peak at lag d. Input beyond the end of the data
+         * supplied is taken to be zero.
+         *
+         * The spectrum of the reference is computed once, upon construction, and cached for the life of the
+         * instance. Data is processed by overlap-save, in blocks of one FFT size, each yielding
+         * FFT size - pulse length + 1 lags. The FFT is a self contained, iterative radix-2 transform with
+         * precomputed twiddle factors, so the FFT size is a power of two. By default, it is the smallest power of
+         * two of at least four pulse lengths, which keeps the overlap overhead at or below a quarter of each block.
+         *
+         * The compression operations are const and may be invoked concurrently. Multiple pulses of a coherent
+         * processing interval may be compressed in parallel across threads.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT PulseCompressor
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Constructor (Chirp Reference)
+             *
+             * The reference pulse is generated by a ChirpingPhasorToneGenerator.
+             *
+             * @param accel Acceleration of the reference pulse in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity of the reference pulse in radians per sample.
+             * @param phi Starting phase angle of the reference pulse in radians.
+             * @param pulseLength The number of samples in the reference pulse.
+             * @param fftSize The FFT size. Zero selects the default.
+             *
+             * @throw Throws std::invalid_argument if the pulse length is zero, or if the FFT size is not a
+             * power of two of at least the pulse length.
+             */
+            PulseCompressor( double accel, double omegaZero, double phi, size_t pulseLength, size_t fftSize=0 );
+
+            /**
+             * @brief Constructor (Arbitrary Reference)
+             *
+             * The reference pulse is supplied, a tapered chirp for example.
+             *
+             * @param pReference Array of reference samples, which are not retained.
+             * @param pulseLength The number of samples in the reference pulse.
+             * @param fftSize The FFT size. Zero selects the default.
+             *
+             * @throw Throws std::invalid_argument if the pulse length is zero, or if the FFT size is not a
+             * power of two of at least the pulse length.
+             */
+            PulseCompressor( const FlyingPhasorElementType * pReference, size_t pulseLength, size_t fftSize=0 );
+
+            /**
+             * @brief Destructor
+             */
+            ~PulseCompressor();
+
+            PulseCompressor( const PulseCompressor & another ) = delete;
+            PulseCompressor & operator=( const PulseCompressor & another ) = delete;
+
+            /**
+             * @brief Compress Operation
+             *
+             * Compresses a block of received data of any length, a range gate or a long stream for example.
+             * A stream may also be compressed in segments, each segment's input overlapping the next by
+             * pulse length - 1 samples.
+             *
+             * @param pInput The received data.
+             * @param numSamples The number of samples of received data, and lags of output.
+             * @param pOutput User provided buffer of numSamples lags which is overwritten. It must not
+             * overlap the input.
+             */
+            void compress( const FlyingPhasorElementType * pInput, size_t numSamples,
+                           FlyingPhasorElementBufferTypePtr pOutput ) const;
+
+            /**
+             * @brief Compress Pulses Operation
+             *
+             * Compresses the range gates of successive pulses, each independently.
+             *
+             * @param pInput The received range gates, numPulses of rangeGateLength samples each.
+             * @param pOutput User provided buffer of numPulses range gates, each range gate length samples,
+             * which is overwritten. It must not overlap the input.
+             * @param numPulses Number of pulses.
+             * @param rangeGateLength The number of samples in a range gate.
+             * @param numThreads Number of threads to distribute pulses over. Zero or one compresses on the
+             * calling thread.
+             */
+            void compressPulses( const FlyingPhasorElementType * pInput, FlyingPhasorElementBufferTypePtr pOutput,
+                                 size_t numPulses, size_t rangeGateLength, unsigned numThreads=1 ) const;
+
+            /**
+             * @brief Get Pulse Length
+             *
+             * @return Returns the number of samples in the reference pulse.
+             */
+            size_t getPulseLength() const;
+
+            /**
+             * @brief Get FFT Size
+             *
+             * @return Returns the FFT size.
+             */
+            size_t getFftSize() const;
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_PULSECOMPRESSOR_H
@@ -0,0 +1,164 @@
+/**
+ * @file RadarSceneSynthesizer.cpp
+ * @brief The implementation file for the Radar Scene Synthesizer.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#include "RadarSceneSynthesizer.h"
+#include "ChirpingPhasorToneGenerator.h"
+#include "ThreadJoiner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class RadarSceneSynthesizer::Imple
+{
+public:
+    // The number of range gate samples processed per block. 16 KiB of samples fits in L1 cache.
+    static constexpr size_t blockSize = 1024;
+
+    Imple( double theAccel, double theOmegaZero, double phi, size_t pulseLength, size_t theRangeGateLength )
+      : accel{ theAccel }
+      , omegaZero{ theOmegaZero }
+      , pulse( pulseLength )
+      , rangeGateLength{ theRangeGateLength }
+    {
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        chirpGen.getSamples( pulse.data(), pulseLength );
+    }
+
+    // The working state of a target return.
+    struct Return
+    {
+        size_t begin;                       // First range gate sample.
+        size_t end;                         // One past the last range gate sample.
+        FlyingPhasorElementType phasor;     // Amplitude, fractional delay and Doppler phasor for the next sample.
+        FlyingPhasorElementType rate;       // Per sample rotation of the phasor.
+        double magSquared;                  // Squared magnitude the phasor is re-normalized to.
+    };
+
+    void synthesize( const Target * pTargets, size_t numTargets, FlyingPhasorElementBufferTypePtr pOut,
+                     double pulseTime ) const
+    {
+        std::fill( pOut, pOut + rangeGateLength, FlyingPhasorElementType{} );
+
+        // Establish returns that actually land in the range gate, ordered by their leading edge.
+        std::vector< Return > returns;
+        returns.reserve( numTargets );
+        for ( size_t i = 0; numTargets != i; ++i )
+        {
+            const auto & target = pTargets[i];
+            if ( target.delay < 0.0 || target.delay >= double( rangeGateLength ) ) continue;
+            const auto whole = std::floor( target.delay );
+            const auto tau = target.delay - whole;
+            const auto begin = size_t( whole );
+            const auto end = std::min( begin + pulse.size(), rangeGateLength );
+            if ( begin == end ) continue;
+
+            // Delaying the chirp by tau subtracts, omegaZero * tau - 0.5 * accel * tau^2 + accel * tau * m,
+            // from its phase at pulse sample m. The Doppler shift adds omegaD * m and the pulse to pulse
+            // progression adds omegaD * pulseTime.
+            const auto phase = -( omegaZero * tau - 0.5 * accel * tau * tau ) + target.doppler * pulseTime;
+            const auto magSquared = std::norm( target.amplitude );
+            returns.push_back( Return{ begin, end, target.amplitude * std::polar( 1.0, phase ),
+                                       std::polar( 1.0, target.doppler - accel * tau ), magSquared } );
+        }
+        std::sort( returns.begin(), returns.end(),
+                   []( const Return & a, const Return & b ) { return a.begin < b.begin; } );
+
+        // Walk the range gate a block at a time, maintaining the set of returns overlapping the block.
+        std::vector< Return > active;
+        auto nextReturn = returns.begin();
+        const auto pPulse = pulse.data();
+        for ( size_t b0 = 0; rangeGateLength > b0 && ( !active.empty() || returns.end() != nextReturn ); b0 += blockSize )
+        {
+            const auto b1 = std::min( b0 + blockSize, rangeGateLength );
+            while ( returns.end() != nextReturn && nextReturn->begin < b1 )
+                active.push_back( *nextReturn++ );
+
+            for ( auto & ret : active )
+            {
+                const auto lo = std::max( ret.begin, b0 );
+                const auto hi = std::min( ret.end, b1 );
+                auto ph = ret.phasor;
+                const auto rate = ret.rate;
+                const auto pSrc = pPulse - ret.begin;
+                for ( size_t n = lo; hi != n; ++n )
+                {
+                    pOut[n] += pSrc[n] * ph;
+                    ph *= rate;
+                }
+
+                // Re-normalize to the target magnitude with a first order Taylor Series approximation
+                // of the square root, as the ChirpingPhasorToneGenerator does for unit magnitude.
+                if ( 0.0 != ret.magSquared )
+                    ph *= 1.0 - ( std::norm( ph ) / ret.magSquared - 1.0 ) / 2.0;
+                ret.phasor = ph;
+            }
+
+            // Retire the returns that have ended.
+            active.erase( std::remove_if( active.begin(), active.end(),
+                                          [b1]( const Return & ret ) { return ret.end <= b1; } ), active.end() );
+        }
+    }
+
+    const double accel;
+    const double omegaZero;
+    std::vector< FlyingPhasorElementType > pulse;
+    const size_t rangeGateLength;
+};
+
+constexpr size_t RadarSceneSynthesizer::Imple::blockSize;
+
+RadarSceneSynthesizer::RadarSceneSynthesizer( double accel, double omegaZero, double phi,
+                                              size_t pulseLength, size_t rangeGateLength )
+  : pImple{ new Imple{ accel, omegaZero, phi, pulseLength, rangeGateLength } }
+{
+}
+
+RadarSceneSynthesizer::~RadarSceneSynthesizer()
+{
+    delete pImple;
+}
+
+void RadarSceneSynthesizer::synthesize( const Target * pTargets, size_t numTargets,
+                                        FlyingPhasorElementBufferTypePtr pRangeGate ) const
+{
+    pImple->synthesize( pTargets, numTargets, pRangeGate, 0.0 );
+}
+
+void RadarSceneSynthesizer::synthesizePulses( const Target * pTargets, size_t numTargets,
+                                              FlyingPhasorElementBufferTypePtr pRangeGates, size_t numPulses,
+                                              double pulseRepetitionInterval, unsigned numThreads ) const
+{
+    const auto gateLength = pImple->rangeGateLength;
+    auto work = [=]( size_t firstPulse, size_t stride ) {
+        for ( size_t p = firstPulse; p < numPulses; p += stride )
+            pImple->synthesize( pTargets, numTargets, pRangeGates + p * gateLength,
+                                double( p ) * pulseRepetitionInterval );
+    };
+
+    if ( numThreads <= 1 || numPulses <= 1 )
+    {
+        work( 0, 1 );
+        return;
+    }
+
+    // Pulses are interleaved across threads. Each pulse is independent and written to its own range gate.
+    const auto stride = std::min< size_t >( numThreads, numPulses );
+    std::vector< std::thread > threads;
+    ThreadJoiner joiner{ threads };
+    for ( size_t t = 1; stride != t; ++t )
+        threads.emplace_back( work, t, stride );
+    work( 0, stride );
+}
+
+size_t RadarSceneSynthesizer::getRangeGateLength() const
+{
+    return pImple->rangeGateLength;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file RadarSceneSynthesizer.h
+ * @brief The specification file for the Radar Scene Synthesizer.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_RADARSCENESYNTHESIZER_H
+#define REISER_RT_RADARSCENESYNTHESIZER_H
+
+#include "ReiserRT_ChirpingPhasorExport.h"
+
+#include "FlyingPhasorToneGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Radar Scene Synthesizer
+         *
+         * This class synthesizes received range gates holding many delayed, Doppler shifted and attenuated
+         * copies of a transmitted chirp pulse. The transmitted pulse is generated once, at construction, by a
+         * ChirpingPhasorToneGenerator. Each target return is then accumulated into the range gate, touching
+         * only the samples that the return overlaps. The return of a target is,
+         * amplitude * exp( j * omegaD * m ) * pulse( m - tau ), for m = n - floor( delay ), where tau is the
+         * fractional part of the delay. As with the ChirpArrayFanOut, the fractional delay of a linear chirp
+         * is exact and reduces, together with the Doppler shift, to a single rotating phasor per target.
+         *
+         * The range gate is processed in cache sized blocks. Within a block, every target overlapping it is
+         * accumulated before moving on, so the block is streamed through cache once regardless of the
+         * number of targets. Multiple pulses of a coherent processing interval may be synthesized in
+         * parallel across threads.
+         *
+         * The synthesis operations are const and may be invoked concurrently.
+         */
+        class ReiserRT_ChirpingPhasor_EXPORT RadarSceneSynthesizer
+        {
+        private:
+            /**
+             * @brief Forward Declaration of Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Target
+             *
+             * The description of a point scatterer.
+             */
+            struct Target
+            {
+                double delay;                           //!< Round trip delay in samples, may be fractional.
+                double doppler;                         //!< Doppler shift in radians per sample.
+                FlyingPhasorElementType amplitude;      //!< Complex amplitude of the return.
+            };
+
+            /**
+             * @brief Constructor
+             *
+             * @param accel Acceleration of the transmitted pulse in radians per sample, per sample.
+             * @param omegaZero Starting angular velocity of the transmitted pulse in radians per sample.
+             * @param phi Starting phase angle of the transmitted pulse in radians.
+             * @param pulseLength The number of samples in the transmitted pulse.
+             * @param rangeGateLength The number of samples in a received range gate.
+             */
+            RadarSceneSynthesizer( double accel, double omegaZero, double phi,
+                                   size_t pulseLength, size_t rangeGateLength );
+
+            /**
+             * @brief Destructor
+             */
+            ~RadarSceneSynthesizer();
+
+            RadarSceneSynthesizer( const RadarSceneSynthesizer & another ) = delete;
+            RadarSceneSynthesizer & operator=( const RadarSceneSynthesizer & another ) = delete;
+
+            /**
+             * @brief Synthesize Operation
+             *
+             * Synthesizes a single received range gate. Targets may be supplied in any order.
+             * Targets with negative delays or delays beyond the range gate contribute nothing.
+             *
+             * @param pTargets Array of targets.
+             * @param numTargets Number of targets.
+             * @param pRangeGate User provided buffer of range gate length which is overwritten.
+             */
+            void synthesize( const Target * pTargets, size_t numTargets, FlyingPhasorElementBufferTypePtr pRangeGate ) const;
+
+            /**
+             * @brief Synthesize Pulses Operation
+             *
+             * Synthesizes the range gates of successive pulses. Target delays are constant from pulse to pulse
+             * while each target's phase advances by its Doppler shift times the pulse repetition interval.
+             *
+             * @param pTargets Array of targets.
+             * @param numTargets Number of targets.
+             * @param pRangeGates User provided buffer of numPulses range gates, each range gate length samples,
+             * which is overwritten.
+             * @param numPulses Number of pulses.
+             * @param pulseRepetitionInterval The pulse repetition interval in samples.
+             * @param numThreads Number of threads to distribute pulses over. Zero or one synthesizes on the
+             * calling thread.
+             */
+            void synthesizePulses( const Target * pTargets, size_t numTargets,
+                                   FlyingPhasorElementBufferTypePtr pRangeGates, size_t numPulses,
+                                   double pulseRepetitionInterval, unsigned numThreads=1 ) const;
+
+            /**
+             * @brief Get Range Gate Length
+             *
+             * @return Returns the number of samples in a range gate.
+             */
+            size_t getRangeGateLength() const;
+
+        private:
+            Imple * pImple;     //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_RADARSCENESYNTHESIZER_H
@@ -0,0 +1,38 @@
+/**
+ * @file ThreadJoiner.h
+ * @brief A private guard which joins a set of started threads upon destruction.
+ * @authors Frank Reiser
+ * @date Initiated October 18th, 2026
+ */
+
+#ifndef REISER_RT_THREADJOINER_H
+#define REISER_RT_THREADJOINER_H
+
+#include <thread>
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Thread Joiner
+         *
+         * Joins any started threads upon destruction. Should starting a thread, or the calling thread's own share
+         * of the work, throw, the threads already started are joined before the exception propagates. Destroying
+         * a joinable std::thread would otherwise invoke std::terminate.
+         */
+        struct ThreadJoiner
+        {
+            std::vector< std::thread > & threads;
+
+            ~ThreadJoiner()
+            {
+                for ( auto & thread : threads )
+                    if ( thread.joinable() ) thread.join();
+            }
+        };
+    }
+}
+
+#endif //REISER_RT_THREADJOINER_H
@@ -0,0 +1,52 @@
+/**
+ * @file SharedMemoryRing.h
+ * @brief The layout of the POSIX shared memory sample ring written by streamChirpingPhasor.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#ifndef REISER_RT_CHIRPINGPHASOR_SHAREDMEMORYRING_H
+#define REISER_RT_CHIRPINGPHASOR_SHAREDMEMORYRING_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Shared Memory Ring Header
+ *
+ * The shared memory object begins with this header, padded to `sampleOffset` bytes, followed by `capacity`
+ * samples of interleaved double precision (real, imaginary) pairs. There is a single producer which never
+ * waits on consumers. The producer generates a chunk of `chunkSize` samples directly into ring positions
+ * [writeIndex % capacity, +chunkSize), wrapping as necessary, then publishes them by storing the new
+ * `writeIndex` with release semantics.
+ *
+ * As the next chunk is written over the oldest `chunkSize` samples of the ring before it is published, only
+ * samples with absolute index in the range [writeIndex - capacity + chunkSize, writeIndex) are stable, present at
+ * ring position, index % capacity. A consumer must:
+ * 1. Load `writeIndex` with acquire semantics.
+ * 2. Copy samples from within the stable range.
+ * 3. Re-load `writeIndex` with acquire semantics, as newWriteIndex.
+ * 4. Discard any copied sample with absolute index less than newWriteIndex - capacity + chunkSize,
+ *    as it may have been overwritten while being copied.
+ *
+ * A consumer that falls behind the stable range has been overrun and must resynchronize.
+ */
+struct SharedMemoryRingHeader
+{
+    static constexpr uint64_t magicValue = 0x474E495250524843ULL;  //!< "CHRPRING" in little endian.
+    static constexpr uint32_t versionValue = 2;                     //!< Layout version.
+    static constexpr uint64_t sampleOffset = 64;                    //!< Byte offset of the first sample.
+
+    uint64_t magic;                         //!< Set to `magicValue` once the ring is initialized.
+    uint32_t version;                       //!< Set to `versionValue`.
+    uint32_t sampleSize;                    //!< Bytes per sample, sixteen for complex double.
+    uint64_t capacity;                      //!< Number of samples the ring holds.
+    uint64_t chunkSize;                     //!< Number of samples written per publication.
+    std::atomic< uint64_t > writeIndex;     //!< Total samples published since the ring was created.
+};
+
+static_assert( sizeof( SharedMemoryRingHeader ) <= SharedMemoryRingHeader::sampleOffset,
+               "SharedMemoryRingHeader must fit within the sample offset" );
+
+#endif //REISER_RT_CHIRPINGPHASOR_SHAREDMEMORYRING_H
@@ -0,0 +1,117 @@
+/**
+ * @file profileDds.cpp
+ * @brief Utility program for profiling the DDS Chirp Generator alongside the ChirpingPhasor Generator.
+ *
+ * Reports the cost (nanoseconds per sample) and purity (peak phase and magnitude errors against
+ * the closed form) of the ChirpingPhasorToneGenerator and of several DDS Chirp Generator configurations.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+#include "DdsChirpGenerator.h"
+
+#include "CommandLineParser.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Closed form phase in long double precision with each term reduced individually.
+    long double closedFormPhase( double accel, double omegaZero, double phi, size_t n )
+    {
+        constexpr long double twoPi = 6.283185307179586476925286766559005768L;
+        const auto s = static_cast< long double >( n );
+        return std::fmod( phi + std::fmod( omegaZero * s, twoPi ) + std::fmod( accel / 2.0L * s * s, twoPi ), twoPi );
+    }
+
+    template < typename Generate >
+    void profile( const char * name, Generate && generate, FlyingPhasorElementBufferTypePtr p,
+                  size_t chunkSize, size_t numChunks, double accel, double omegaZero, double phi )
+    {
+        // Timing pass.
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+            generate( p, chunkSize, 0 == chunk );
+        const auto stop = std::chrono::steady_clock::now();
+        const auto ns = std::chrono::duration< double, std::nano >( stop - start ).count();
+
+        // Purity pass.
+        double maxPhaseErr = 0.0;
+        double maxMagErr = 0.0;
+        size_t sampleCount = 0;
+        for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+        {
+            generate( p, chunkSize, 0 == chunk );
+            for ( size_t n = 0; chunkSize != n; ++n )
+            {
+                const auto theta = double( closedFormPhase( accel, omegaZero, phi, sampleCount++ ) );
+                const auto phaseErr = std::abs( std::arg( p[n] * std::polar( 1.0, -theta ) ) );
+                if ( phaseErr > maxPhaseErr ) maxPhaseErr = phaseErr;
+                const auto magErr = std::abs( std::abs( p[n] ) - 1.0 );
+                if ( magErr > maxMagErr ) maxMagErr = magErr;
+            }
+        }
+
+        std::cout << name << " " << ns / double( chunkSize * numChunks ) << " "
+                  << maxPhaseErr << " " << maxMagErr << std::endl;
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    CommandLineParser cmdLineParser{};
+    if ( 0 != cmdLineParser.parseCommandLine( argc, argv ) )
+    {
+        std::cerr << "profileDds Parse Error: Supports --accel, --omegaZero, --phi, --chunkSize and --numChunks."
+                  << std::endl;
+        exit( 1 );
+    }
+
+    const auto accel = cmdLineParser.getAccel();
+    const auto omegaZero = cmdLineParser.getOmegaZero();
+    const auto phi = cmdLineParser.getPhi();
+    const auto chunkSize = cmdLineParser.getChunkSize();
+    const auto numChunks = cmdLineParser.getNumChunks();
+
+    std::unique_ptr< FlyingPhasorElementType[] > pSampleSeries{ new FlyingPhasorElementType [ chunkSize ] };
+    FlyingPhasorElementBufferTypePtr p = pSampleSeries.get();
+
+    std::cout << "Samples: " << chunkSize * numChunks << std::endl;
+    std::cout << "Generator  nsPerSample  maxPhaseErr(rad)  maxMagErr" << std::endl;
+
+    ChirpingPhasorToneGenerator chirpGen{};
+    profile( "ChirpingPhasor",
+             [&]( FlyingPhasorElementBufferTypePtr pBuf, size_t n, bool first ) {
+                 if ( first ) chirpGen.reset( accel, omegaZero, phi );
+                 chirpGen.getSamples( pBuf, n );
+             }, p, chunkSize, numChunks, accel, omegaZero, phi );
+
+    struct DdsConfig { const char * name; unsigned addressBits; unsigned amplitudeBits; bool interpolate; };
+    const DdsConfig configs[] = {
+        { "Dds10x16", 10, 16, false },
+        { "Dds12x16", 12, 16, false },
+        { "Dds16x16", 16, 16, false },
+        { "Dds10x16Interp", 10, 16, true },
+        { "Dds12x24Interp", 12, 24, true },
+        { "Dds20x24", 20, 24, false },
+    };
+    for ( const auto & config : configs )
+    {
+        DdsChirpGenerator dds{ config.addressBits, config.amplitudeBits, config.interpolate };
+        profile( config.name,
+                 [&]( FlyingPhasorElementBufferTypePtr pBuf, size_t n, bool first ) {
+                     if ( first ) dds.reset( accel, omegaZero, phi );
+                     dds.getSamples( pBuf, n );
+                 }, p, chunkSize, numChunks, accel, omegaZero, phi );
+    }
+
+    exit( 0 );
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file profilePulseCompressor.cpp
+ * @brief Utility program for profiling the Pulse Compressor against direct time domain correlation.
+ *
+ * For a range of pulse lengths, received range gates (chunks) holding an echo of a chirp are compressed by direct
+ * correlation and by the Pulse Compressor, serially and in parallel across pulses. Reports the cost
+ * (nanoseconds per range gate sample) of each, the speedup of fast convolution and the peak difference
+ * between the two.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+#include "PulseCompressor.h"
+
+#include "CommandLineParser.h"
+#include "MiscTestUtilities.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    template < typename Operation >
+    double nsPerSample( Operation && operation, size_t numSamples )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        operation();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration< double, std::nano >( stop - start ).count() / double( numSamples );
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    CommandLineParser cmdLineParser{};
+    if ( 0 != cmdLineParser.parseCommandLine( argc, argv ) ||
+         0 == cmdLineParser.getChunkSize() || 0 == cmdLineParser.getNumChunks() )
+    {
+        std::cerr << "profilePulseCompressor Parse Error: Supports --accel, --omegaZero, --phi, --chunkSize, "
+                  << "--numChunks and --numThreads. The chunkSize and numChunks must be nonzero." << std::endl;
+        exit( 1 );
+    }
+
+    const auto accel = cmdLineParser.getAccel();
+    const auto omegaZero = cmdLineParser.getOmegaZero();
+    const auto phi = cmdLineParser.getPhi();
+    const auto gateLength = size_t( cmdLineParser.getChunkSize() );
+    const auto numPulses = size_t( cmdLineParser.getNumChunks() );
+    auto numThreads = unsigned( cmdLineParser.getNumThreads() );
+    if ( 0 == numThreads ) numThreads = std::max( 1U, std::thread::hardware_concurrency() );
+
+    const auto numSamples = gateLength * numPulses;
+    std::vector< FlyingPhasorElementType > input( numSamples );
+    std::vector< FlyingPhasorElementType > direct( numSamples );
+    std::vector< FlyingPhasorElementType > fast( numSamples );
+
+    std::cout << "Range gate samples: " << numSamples << " (" << numPulses << " x " << gateLength
+              << "), threads: " << numThreads << std::endl;
+    std::cout << "pulseLength  fftSize  directNsPerSample  fftNsPerSample  speedup  parallelNsPerSample  maxDiff"
+              << std::endl;
+
+    for ( size_t pulseLength = 16; gateLength >= pulseLength; pulseLength *= 4 )
+    {
+        // Each range gate holds an echo of the reference a quarter of the way in.
+        std::vector< FlyingPhasorElementType > reference( pulseLength );
+        ChirpingPhasorToneGenerator generator{ accel, omegaZero, phi };
+        generator.getSamples( reference.data(), pulseLength );
+        std::fill( input.begin(), input.end(), FlyingPhasorElementType{} );
+        for ( size_t p = 0; numPulses != p; ++p )
+        {
+            const auto delay = p * gateLength + gateLength / 4;
+            for ( size_t k = 0; pulseLength != k && gateLength / 4 + k < gateLength; ++k )
+                input[ delay + k ] = reference[k];
+        }
+
+        const PulseCompressor compressor{ reference.data(), pulseLength };
+
+        const auto directNs = nsPerSample( [&]() {
+            for ( size_t p = 0; numPulses != p; ++p )
+                directCorrelation( reference, input.data() + p * gateLength, gateLength,
+                                   direct.data() + p * gateLength );
+        }, numSamples );
+
+        const auto fastNs = nsPerSample( [&]() {
+            compressor.compressPulses( input.data(), fast.data(), numPulses, gateLength );
+        }, numSamples );
+
+        const auto maxDiff = maxError( direct, fast );
+
+        const auto parallelNs = nsPerSample( [&]() {
+            compressor.compressPulses( input.data(), fast.data(), numPulses, gateLength, numThreads );
+        }, numSamples );
+
+        std::cout << pulseLength << " " << compressor.getFftSize() << " " << directNs << " " << fastNs << " "
+                  << directNs / fastNs << " " << parallelNs << " " << maxDiff << std::endl;
+    }
+
+    exit( 0 );
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file profileResync.cpp
+ * @brief Utility program for profiling the accuracy versus cost of the ChirpingPhasor resync interval.
+ *
+ * For a series of resync intervals, the chirp is generated twice. Once for timing purposes only, and
+ * once more to measure the peak phase error against a compensated (double-double) closed form reference.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include "CommandLineParser.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // A minimal double-double angle accumulator for our reference phase.
+    struct Angle { double hi; double lo; };
+
+    Angle twoSum( double a, double b )
+    {
+        const auto s = a + b;
+        const auto bb = s - a;
+        return { s, ( a - ( s - bb ) ) + ( b - bb ) };
+    }
+
+    Angle add( const Angle & x, const Angle & y )
+    {
+        auto s = twoSum( x.hi, y.hi );
+        const auto t = twoSum( x.lo, y.lo );
+        s = twoSum( s.hi, s.lo + t.hi );
+        return twoSum( s.hi, s.lo + t.lo );
+    }
+
+    Angle wrap( const Angle & x )
+    {
+        constexpr double twoPiHi = 6.283185307179586232;
+        constexpr double twoPiLo = 2.4492935982947064e-16;
+        const auto k = std::nearbyint( x.hi / twoPiHi );
+        if ( 0.0 == k ) return x;
+        const auto p = -k * twoPiHi;
+        return add( x, add( { p, std::fma( -k, twoPiHi, -p ) }, { -k * twoPiLo, 0.0 } ) );
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    CommandLineParser cmdLineParser{};
+    if ( 0 != cmdLineParser.parseCommandLine( argc, argv ) )
+    {
+        std::cerr << "profileResync Parse Error: Supports --accel, --omegaZero, --phi, --chunkSize and --numChunks."
+                  << std::endl;
+        exit( 1 );
+    }
+
+    const auto accel = cmdLineParser.getAccel();
+    const auto omegaZero = cmdLineParser.getOmegaZero();
+    const auto phi = cmdLineParser.getPhi();
+    const auto chunkSize = cmdLineParser.getChunkSize();
+    const auto numChunks = cmdLineParser.getNumChunks();
+
+    std::unique_ptr< FlyingPhasorElementType[] > pSampleSeries{ new FlyingPhasorElementType [ chunkSize ] };
+    FlyingPhasorElementBufferTypePtr p = pSampleSeries.get();
+
+    std::cout << "Samples: " << chunkSize * numChunks << std::endl;
+    std::cout << "ResyncInterval  nsPerSample  maxPhaseErr(rad)" << std::endl;
+
+    const size_t intervals[] = { 0, 64, 256, 1024, 4096, 16384, 65536, 262144 };
+    for ( const auto interval : intervals )
+    {
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        chirpGen.setResyncInterval( interval );
+
+        // Timing pass.
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+            chirpGen.getSamples( p, chunkSize );
+        const auto stop = std::chrono::steady_clock::now();
+        const auto ns = std::chrono::duration< double, std::nano >( stop - start ).count();
+
+        // Accuracy pass.
+        chirpGen.reset( accel, omegaZero, phi );
+        Angle theta = wrap( { phi, 0.0 } );
+        Angle omegaBar = wrap( { omegaZero + accel / 2.0, 0.0 } );
+        double maxPhaseErr = 0.0;
+        for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+        {
+            chirpGen.getSamples( p, chunkSize );
+            for ( size_t n = 0; chunkSize != n; ++n )
+            {
+                const auto err = std::abs( std::arg( p[n] * std::polar( 1.0, -theta.hi ) ) );
+                if ( err > maxPhaseErr ) maxPhaseErr = err;
+                theta = wrap( add( theta, omegaBar ) );
+                omegaBar = wrap( add( omegaBar, { accel, 0.0 } ) );
+            }
+        }
+
+        std::cout << interval << " " << ns / double( chunkSize * numChunks ) << " " << maxPhaseErr << std::endl;
+    }
+
+    exit( 0 );
+    return 0;
+}
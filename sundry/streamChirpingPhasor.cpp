@@ -7,12 +7,29 @@
  */
 
 #include "ChirpingPhasorToneGenerator.h"
+#include "ComplexGaussianNoiseSource.h"
+#include "LatencyHistogram.h"
 
 #include "CommandLineParser.h"
+#include "SharedMemoryRing.h"
 
+#include <algorithm>
+#include <csignal>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <limits>
+#include <new>
+#include <sstream>
+#include <string>
+
+// Shared memory rings and the SIGUSR1 latency dump are available on POSIX platforms only.
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 using namespace ReiserRT::Signal;
 
@@ -48,17 +65,163 @@ void printHelpScreen()
     std::cout << "        t64 - Outputs samples in text format with floating point precision (17 decimal places)." << std::endl;
     std::cout << "        b32 - Outputs data in raw binary with 32bit precision (uint32 and float), native endian-ness." << std::endl;
     std::cout << "        b64 - Outputs data in raw binary 64bit precision (uint64 and double), native endian-ness." << std::endl;
+    std::cout << "        r32 - Outputs real parts only in raw binary with 32bit precision (uint32 and float), native endian-ness." << std::endl;
+    std::cout << "        r64 - Outputs real parts only in raw binary 64bit precision (uint64 and double), native endian-ness." << std::endl;
+    std::cout << "        npy32 - Outputs a NumPy .npy file of complex64, loadable with numpy.load( path, mmap_mode='r' )." << std::endl;
+    std::cout << "        npy64 (or npy) - Outputs a NumPy .npy file of complex128." << std::endl;
+    std::cout << "            The npy formats require a nonzero numChunks, as the shape is written up front. Should the run" << std::endl;
+    std::cout << "            be stopped early, the shape in an outFile is rewritten with the number of chunks actually written." << std::endl;
+    std::cout << "        sigmf32 - Outputs a SigMF recording of cf32, <outFile>.sigmf-data and <outFile>.sigmf-meta." << std::endl;
+    std::cout << "        sigmf64 (or sigmf) - Outputs a SigMF recording of cf64." << std::endl;
+    std::cout << "            The sigmf formats require outFile. The metadata records the chirp parameters and chunk layout,"
+              << " and is likewise rewritten should the run be stopped early." << std::endl;
     std::cout << "        Defaults to t64 if unspecified." << std::endl;
     std::cout << "    --includeX" << std::endl;
     std::cout << "        Include sample count in the output stream. This is useful for gnuplot using any format." << std::endl;
+    std::cout << "        Does not apply to the npy and sigmf formats." << std::endl;
     std::cout << "        Defaults to no inclusion if unspecified." << std::endl;
+    std::cout << "    --shmRing=<string>" << std::endl;
+    std::cout << "        Writes samples into the named POSIX shared memory ring instead of standard output." << std::endl;
+    std::cout << "        Samples are complex double. Other local processes may map the ring without copying." << std::endl;
+    std::cout << "        See SharedMemoryRing.h for the layout. The ring is left in place on exit." << std::endl;
+    std::cout << "        The streamFormat and includeX options do not apply. Available on POSIX platforms only." << std::endl;
+    std::cout << "    --ringSize=<uint>" << std::endl;
+    std::cout << "        The number of samples the shared memory ring holds. Must be at least chunkSize." << std::endl;
+    std::cout << "        Defaults to 1048576 samples if unspecified." << std::endl;
+    std::cout << "    --snr=<double>" << std::endl;
+    std::cout << "        Adds complex white Gaussian noise at the signal to noise ratio specified in decibels." << std::endl;
+    std::cout << "        Defaults to no noise if unspecified." << std::endl;
+    std::cout << "    --seed=<uint>" << std::endl;
+    std::cout << "        The noise seed. The same seed reproduces the same noise." << std::endl;
+    std::cout << "        Defaults to 0 if unspecified." << std::endl;
+    std::cout << "    --outFile=<string>" << std::endl;
+    std::cout << "        Writes output to the named file instead of standard output." << std::endl;
+    std::cout << "        For the sigmf formats, this is the recording base name, less any extension." << std::endl;
+    std::cout << "    --latencyHistogram" << std::endl;
+    std::cout << "        Records the latency of sample generation and of each whole chunk (generation and output)" << std::endl;
+    std::cout << "        into log bucketed histograms. Their count, min, mean, p50, p99, p99.9 and max are written" << std::endl;
+    std::cout << "        to standard error on exit, on SIGINT or SIGTERM, and upon SIGUSR1 without exiting." << std::endl;
+    std::cout << "        SIGUSR1 is handled on POSIX platforms only." << std::endl;
+    std::cout << "        Defaults to no recording if unspecified." << std::endl;
     std::cout << std::endl;
     std::cout << "Error Returns:" << std::endl;
     std::cout << "    1 - Command Line Parsing Error - Unrecognized Long Option." << std::endl;
     std::cout << "    2 - Command Line Parsing Error - Unrecognized Short Option (none supported)." << std::endl;
     std::cout << "    3 - Invalid streamFormat specified." << std::endl;
+    std::cout << "    4 - Invalid ringSize specified, it is less than chunkSize." << std::endl;
+    std::cout << "    5 - Failed to create or map the shared memory ring." << std::endl;
+    std::cout << "    6 - The streamFormat requires an outFile or a nonzero numChunks that was not specified." << std::endl;
+    std::cout << "    7 - Failed to open an output file." << std::endl;
+    std::cout << "    8 - Shared memory rings are not supported on this platform." << std::endl;
+}
+
+// Latency histogram signal requests, acted upon by the chunk loop.
+volatile std::sig_atomic_t latencyDumpRequested = 0;
+volatile std::sig_atomic_t stopRequested = 0;
+
+extern "C" void onLatencyDumpSignal( int ) { latencyDumpRequested = 1; }
+extern "C" void onStopSignal( int ) { stopRequested = 1; }
+
+void reportLatency( const LatencyHistogram & generateHistogram, const LatencyHistogram & chunkHistogram )
+{
+    generateHistogram.report( std::cerr, "streamChirpingPhasor generate" );
+    chunkHistogram.report( std::cerr, "streamChirpingPhasor chunk" );
+}
+
+bool isLittleEndian()
+{
+    const uint16_t probe = 1;
+    return 1 == *reinterpret_cast< const unsigned char * >( &probe );
+}
+
+size_t writeNpyHeader( std::ostream & out, bool singlePrecision, uint64_t numSamples, size_t minSize=0 )
+{
+    // NPY format version 1.0. The header dictionary is padded with spaces and terminated with a newline
+    // so that the data begins on a 64 byte boundary, which keeps memory mapped access aligned.
+    // A header rewritten in place is padded out to the size of the original.
+    std::ostringstream dict;
+    dict << "{'descr': '" << ( isLittleEndian() ? '<' : '>' ) << ( singlePrecision ? "c8" : "c16" )
+         << "', 'fortran_order': False, 'shape': (" << numSamples << ",), }";
+    auto header = dict.str();
+    const size_t preambleSize = 10;
+    header.append( 63 - ( preambleSize + header.size() ) % 64, ' ' );
+    if ( preambleSize + header.size() + 1 < minSize )
+        header.append( minSize - ( preambleSize + header.size() + 1 ), ' ' );
+    header.push_back( '\n' );
+
+    const auto headerSize = uint16_t( header.size() );
+    const unsigned char preamble[ preambleSize ] = { 0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+        static_cast< unsigned char >( headerSize & 0xFF ), static_cast< unsigned char >( headerSize >> 8 ) };
+    out.write( reinterpret_cast< const char * >( preamble ), preambleSize );
+    out.write( header.data(), std::streamsize( header.size() ) );
+    return preambleSize + header.size();
+}
+
+bool writeSigMFMeta( const std::string & path, bool singlePrecision, const CommandLineParser & cmdLineParser,
+                     uint64_t numChunks )
+{
+    std::ofstream meta{ path };
+    if ( !meta ) return false;
+
+    meta.precision( 17 );
+    meta << "{\n";
+    meta << "    \"global\": {\n";
+    meta << "        \"core:datatype\": \"" << ( singlePrecision ? "cf32" : "cf64" )
+         << ( isLittleEndian() ? "_le" : "_be" ) << "\",\n";
+    meta << "        \"core:version\": \"1.0.0\",\n";
+    meta << "        \"core:recorder\": \"streamChirpingPhasor\",\n";
+    meta << "        \"core:description\": \"ReiserRT ChirpingPhasorToneGenerator output. Rates are normalized"
+         << " to radians per sample.\",\n";
+    meta << "        \"core:extensions\": [ { \"name\": \"reiserrt\", \"version\": \"1.0.0\", \"optional\": true } ],\n";
+    meta << "        \"reiserrt:accel\": " << cmdLineParser.getAccel() << ",\n";
+    meta << "        \"reiserrt:omega_zero\": " << cmdLineParser.getOmegaZero() << ",\n";
+    meta << "        \"reiserrt:phi\": " << cmdLineParser.getPhi() << ",\n";
+    if ( cmdLineParser.getSnrSpecified() )
+    {
+        meta << "        \"reiserrt:snr_db\": " << cmdLineParser.getSnr() << ",\n";
+        meta << "        \"reiserrt:seed\": " << cmdLineParser.getSeed() << ",\n";
+    }
+    meta << "        \"reiserrt:chunk_size\": " << cmdLineParser.getChunkSize() << ",\n";
+    meta << "        \"reiserrt:num_chunks\": " << numChunks << ",\n";
+    meta << "        \"reiserrt:skip_chunks\": " << cmdLineParser.getSkipChunks() << "\n";
+    meta << "    },\n";
+    meta << "    \"captures\": [\n";
+    meta << "        { \"core:sample_start\": 0, \"reiserrt:generator_sample_start\": "
+         << cmdLineParser.getSkipChunks() * cmdLineParser.getChunkSize() << " }\n";
+    meta << "    ],\n";
+    meta << "    \"annotations\": []\n";
+    meta << "}\n";
+    return bool( meta );
 }
 
+#if defined(__unix__) || defined(__APPLE__)
+SharedMemoryRingHeader * openSharedMemoryRing( std::string name, size_t capacity, size_t chunkSize )
+{
+    if ( name.empty() || '/' != name.front() ) name.insert( 0, 1, '/' );
+
+    const auto fd = shm_open( name.c_str(), O_CREAT | O_RDWR, 0600 );
+    if ( -1 == fd ) return nullptr;
+
+    const auto numBytes = SharedMemoryRingHeader::sampleOffset + capacity * sizeof( FlyingPhasorElementType );
+    void * pMem = MAP_FAILED;
+    if ( 0 == ftruncate( fd, off_t( numBytes ) ) )
+        pMem = mmap( nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( MAP_FAILED == pMem ) return nullptr;
+
+    // Initialize the header. The magic is stored last so that a consumer seeing it sees a valid header.
+    auto pHeader = new ( pMem ) SharedMemoryRingHeader{};
+    pHeader->version = SharedMemoryRingHeader::versionValue;
+    pHeader->sampleSize = uint32_t( sizeof( FlyingPhasorElementType ) );
+    pHeader->capacity = capacity;
+    pHeader->chunkSize = chunkSize;
+    pHeader->writeIndex.store( 0, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+    pHeader->magic = SharedMemoryRingHeader::magicValue;
+    return pHeader;
+}
+#endif
+
 int main( int argc, char * argv[] )
 {
     // Parse potential command line. Defaults provided otherwise.
@@ -103,35 +266,180 @@ int main( int argc, char * argv[] )
         exit( 3 );
     }
 
+    // NPY and SigMF formats. A NPY header records the shape, so the number of samples must be known up front.
+    // A SigMF recording is a pair of files, so it must be named.
+    const auto npyFormat = CommandLineParser::StreamFormat::Npy32 == streamFormat ||
+                           CommandLineParser::StreamFormat::Npy64 == streamFormat;
+    const auto sigmfFormat = CommandLineParser::StreamFormat::SigMF32 == streamFormat ||
+                             CommandLineParser::StreamFormat::SigMF64 == streamFormat;
+    const auto & outFile = cmdLineParser.getOutFile();
+    if ( ( npyFormat && 0 == cmdLineParser.getNumChunks() ) || ( sigmfFormat && outFile.empty() ) )
+    {
+        std::cerr << "streamChirpingPhasor Error: Stream Format requires outFile or numChunks. Use --help for instructions" << std::endl;
+        exit( 6 );
+    }
+
+    // Are we writing to a file rather than standard output?
+    std::ofstream outFileStream{};
+    if ( !outFile.empty() && cmdLineParser.getShmRing().empty() )
+    {
+        const auto dataPath = sigmfFormat ? outFile + ".sigmf-data" : outFile;
+        outFileStream.open( dataPath, std::ios::out | std::ios::binary | std::ios::trunc );
+        if ( !outFileStream )
+        {
+            std::cerr << "streamChirpingPhasor Error: Failed to open output file " << dataPath << std::endl;
+            exit( 7 );
+        }
+    }
+    std::ostream & out = outFileStream.is_open() ? outFileStream : std::cout;
+
+    // Are we writing into a shared memory ring?
+    const auto & shmRing = cmdLineParser.getShmRing();
+    const auto ringSize = cmdLineParser.getRingSize();
+    SharedMemoryRingHeader * pRingHeader = nullptr;
+    FlyingPhasorElementBufferTypePtr pRing = nullptr;
+    if ( !shmRing.empty() )
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if ( ringSize < chunkSize || 0 == ringSize )
+        {
+            std::cerr << "streamChirpingPhasor Error: Invalid Ring Size Specified. Use --help for instructions" << std::endl;
+            exit( 4 );
+        }
+        pRingHeader = openSharedMemoryRing( shmRing, ringSize, chunkSize );
+        if ( !pRingHeader )
+        {
+            std::cerr << "streamChirpingPhasor Error: Failed to create shared memory ring " << shmRing << std::endl;
+            exit( 5 );
+        }
+        pRing = reinterpret_cast< FlyingPhasorElementBufferTypePtr >(
+            reinterpret_cast< unsigned char * >( pRingHeader ) + SharedMemoryRingHeader::sampleOffset );
+#else
+        std::cerr << "streamChirpingPhasor Error: Shared memory rings are not supported on this platform" << std::endl;
+        exit( 8 );
+#endif
+    }
+
     // Instantiate a Chirping Phasor
     ChirpingPhasorToneGenerator chirpingPhasorToneGenerator{ accel, omegaZero, phi };
 
+    // Instantiate a Noise Source if noise is requested. The signal has unit power.
+    std::unique_ptr< ComplexGaussianNoiseSource > pNoiseSource{};
+    if ( cmdLineParser.getSnrSpecified() )
+        pNoiseSource.reset( new ComplexGaussianNoiseSource{ cmdLineParser.getSeed(), 0,
+            ComplexGaussianNoiseSource::noisePowerForSnr( 1.0, cmdLineParser.getSnr() ) } );
+    auto getSamples = [&]( FlyingPhasorElementBufferTypePtr pBuf, size_t numSamples )
+    {
+        if ( pNoiseSource )
+            chirpingPhasorToneGenerator.getSamplesWithNoise( pBuf, numSamples, *pNoiseSource );
+        else
+            chirpingPhasorToneGenerator.getSamples( pBuf, numSamples );
+    };
+
     // Allocate Memory for Chunk Size
     std::unique_ptr< FlyingPhasorElementType[] > pSampleSeries{ new FlyingPhasorElementType [ chunkSize ] };
 
+    // Real only formats require only the real parts, which may be generated without storing complex samples.
+    const auto realFormat = CommandLineParser::StreamFormat::Real32 == streamFormat ||
+                            CommandLineParser::StreamFormat::Real64 == streamFormat;
+    std::unique_ptr< double[] > pRealSeries{ realFormat ? new double [ chunkSize ] : nullptr };
+
+    // Single precision NPY and SigMF formats are converted into an interleaved buffer and written in bulk.
+    // Double precision formats are written in bulk directly from the sample series.
+    const auto bulkFormat = npyFormat || sigmfFormat;
+    const auto singlePrecisionBulk = CommandLineParser::StreamFormat::Npy32 == streamFormat ||
+                                     CommandLineParser::StreamFormat::SigMF32 == streamFormat;
+    std::unique_ptr< float[] > pFloatSeries{ singlePrecisionBulk ? new float [ 2 * chunkSize ] : nullptr };
+    // The NPY shape and SigMF metadata record the number of chunks requested. Should the run be stopped early,
+    // they are rewritten with the number of chunks actually written.
+    size_t npyHeaderSize = 0;
+    if ( npyFormat && !pRingHeader )
+        npyHeaderSize = writeNpyHeader( out, singlePrecisionBulk, uint64_t( cmdLineParser.getNumChunks() ) * chunkSize );
+    if ( sigmfFormat && !pRingHeader && !writeSigMFMeta( outFile + ".sigmf-meta", singlePrecisionBulk, cmdLineParser,
+                                                         cmdLineParser.getNumChunks() ) )
+    {
+        std::cerr << "streamChirpingPhasor Error: Failed to write output file " << outFile << ".sigmf-meta" << std::endl;
+        exit( 7 );
+    }
+
     // If we are using a text stream format, set the output precision
     if ( CommandLineParser::StreamFormat::Text32 == streamFormat)
     {
-        std::cout << std::scientific;
-        std::cout.precision(9);
+        out << std::scientific;
+        out.precision(9);
     }
     else if ( CommandLineParser::StreamFormat::Text64 == streamFormat)
     {
-        std::cout << std::scientific;
-        std::cout.precision(17);
+        out << std::scientific;
+        out.precision(17);
     }
 
     // Are we including Sample count in the output?
     auto includeX = cmdLineParser.getIncludeX();
 
+    // Are we recording latencies? If so, the signals are handled so that histograms may be dumped on demand
+    // and on termination. Histograms are large, so they are allocated only if recording.
+    std::unique_ptr< LatencyHistogram > pGenerateHistogram{};
+    std::unique_ptr< LatencyHistogram > pChunkHistogram{};
+    if ( cmdLineParser.getLatencyHistogram() )
+    {
+        pGenerateHistogram.reset( new LatencyHistogram{} );
+        pChunkHistogram.reset( new LatencyHistogram{} );
+#if defined(__unix__) || defined(__APPLE__)
+        std::signal( SIGUSR1, onLatencyDumpSignal );
+#endif
+        std::signal( SIGINT, onStopSignal );
+        std::signal( SIGTERM, onStopSignal );
+    }
+
     FlyingPhasorElementBufferTypePtr p = pSampleSeries.get();
+    double * pReal = pRealSeries.get();
     size_t sampleCount = 0;
     size_t skippedChunks = 0;
-    for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+    size_t writtenChunks = 0;
+    for ( size_t chunk = 0; numChunks != chunk && !stopRequested; ++chunk )
     {
+        if ( latencyDumpRequested )
+        {
+            latencyDumpRequested = 0;
+            reportLatency( *pGenerateHistogram, *pChunkHistogram );
+        }
+        ScopedLatencyTimer chunkTimer{ pChunkHistogram.get() };
+
+        // Shared memory ring output? Samples are generated directly into the ring, in two spans should
+        // the chunk wrap around its end, and then published. This overwrites the oldest chunk of the ring
+        // while it is still within [writeIndex - capacity, writeIndex), which is why consumers may only
+        // rely upon the stable range described in SharedMemoryRing.h.
+        if ( pRingHeader && skipChunks == skippedChunks )
+        {
+            const auto writeIndex = pRingHeader->writeIndex.load( std::memory_order_relaxed );
+            const auto pos = writeIndex % ringSize;
+            const auto numFirst = std::min< size_t >( chunkSize, ringSize - pos );
+            ScopedLatencyTimer generateTimer{ pGenerateHistogram.get() };
+            if ( pNoiseSource )
+            {
+                getSamples( pRing + pos, numFirst );
+                getSamples( pRing, chunkSize - numFirst );
+            }
+            else
+                chirpingPhasorToneGenerator.getSamples( pRing + pos, numFirst, pRing, chunkSize - numFirst );
+            pRingHeader->writeIndex.store( writeIndex + chunkSize, std::memory_order_release );
+            continue;
+        }
+
         // Get Samples. If we are skipping chunks, we may not output, but we must
         // maintain chirping phasor state.
-        chirpingPhasorToneGenerator.getSamples( p, chunkSize );
+        {
+            ScopedLatencyTimer generateTimer{ pGenerateHistogram.get() };
+            if ( realFormat && !pNoiseSource )
+                chirpingPhasorToneGenerator.getRealSamples( pReal, chunkSize );
+            else
+            {
+                getSamples( p, chunkSize );
+                if ( realFormat )
+                    for ( size_t n = 0; chunkSize != n; ++n ) pReal[n] = p[n].real();
+            }
+        }
 
         // Skip this Chunk?
         if ( skipChunks != skippedChunks )
@@ -141,13 +449,29 @@ int main( int argc, char * argv[] )
             continue;
         }
 
-        if ( CommandLineParser::StreamFormat::Text32 == streamFormat ||
+        if ( bulkFormat )
+        {
+            if ( singlePrecisionBulk )
+            {
+                for ( size_t n = 0; chunkSize != n; ++n )
+                {
+                    pFloatSeries[ 2 * n ] = float( p[n].real() );
+                    pFloatSeries[ 2 * n + 1 ] = float( p[n].imag() );
+                }
+                out.write( reinterpret_cast< const char * >( pFloatSeries.get() ),
+                           std::streamsize( 2 * chunkSize * sizeof( float ) ) );
+            }
+            else
+                out.write( reinterpret_cast< const char * >( p ),
+                           std::streamsize( chunkSize * sizeof( FlyingPhasorElementType ) ) );
+        }
+        else if ( CommandLineParser::StreamFormat::Text32 == streamFormat ||
              CommandLineParser::StreamFormat::Text64 == streamFormat )
         {
             for ( size_t n = 0; chunkSize != n; ++n )
             {
-                if ( includeX ) std::cout << sampleCount++ << " ";
-                std::cout << p[n].real() << " " << p[n].imag() << std::endl;
+                if ( includeX ) out << sampleCount++ << " ";
+                out << p[n].real() << " " << p[n].imag() << std::endl;
             }
         }
         else if ( CommandLineParser::StreamFormat::Bin32 == streamFormat )
@@ -157,12 +481,12 @@ int main( int argc, char * argv[] )
                 if ( includeX )
                 {
                     auto sVal = uint32_t( sampleCount++);
-                    std::cout.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
+                    out.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
                 }
                 auto fVal = float( p[n].real() );
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
+                out.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
                 fVal = float( p[n].imag() );
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
+                out.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
             }
         }
         else if ( CommandLineParser::StreamFormat::Bin64 == streamFormat )
@@ -172,18 +496,67 @@ int main( int argc, char * argv[] )
                 if ( includeX )
                 {
                     auto sVal = sampleCount++;
-                    std::cout.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
+                    out.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
                 }
                 auto fVal = p[n].real();
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
+                out.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
                 fVal = p[n].imag();
-                std::cout.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
+                out.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
             }
         }
-        std::cout.flush();
+        else if ( CommandLineParser::StreamFormat::Real32 == streamFormat )
+        {
+            for ( size_t n = 0; chunkSize != n; ++n )
+            {
+                if ( includeX )
+                {
+                    auto sVal = uint32_t( sampleCount++);
+                    out.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
+                }
+                auto fVal = float( pReal[n] );
+                out.write( reinterpret_cast< const char * >(&fVal), sizeof( fVal ) );
+            }
+        }
+        else if ( CommandLineParser::StreamFormat::Real64 == streamFormat )
+        {
+            for ( size_t n = 0; chunkSize != n; ++n )
+            {
+                if ( includeX )
+                {
+                    auto sVal = sampleCount++;
+                    out.write( reinterpret_cast< const char * >(&sVal), sizeof( sVal ) );
+                }
+                out.write( reinterpret_cast< const char * >(&pReal[n]), sizeof( pReal[n] ) );
+            }
+        }
+        out.flush();
+        ++writtenChunks;
+    }
 
+    if ( bulkFormat && !pRingHeader && writtenChunks != size_t( cmdLineParser.getNumChunks() ) )
+    {
+        if ( npyFormat && outFileStream.is_open() )
+        {
+            outFileStream.seekp( 0 );
+            writeNpyHeader( outFileStream, singlePrecisionBulk, uint64_t( writtenChunks ) * chunkSize, npyHeaderSize );
+            outFileStream.flush();
+        }
+        else if ( npyFormat )
+            std::cerr << "streamChirpingPhasor Warning: Stopped early, the NPY shape written to standard output"
+                      << " overstates the " << writtenChunks << " chunks written" << std::endl;
+
+        if ( sigmfFormat && !writeSigMFMeta( outFile + ".sigmf-meta", singlePrecisionBulk, cmdLineParser,
+                                             writtenChunks ) )
+        {
+            std::cerr << "streamChirpingPhasor Error: Failed to write output file " << outFile << ".sigmf-meta"
+                      << std::endl;
+            exit( 7 );
+        }
     }
 
+    if ( pGenerateHistogram )
+        reportLatency( *pGenerateHistogram, *pChunkHistogram );
+
     exit( 0 );
     return 0;
 }
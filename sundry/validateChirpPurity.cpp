@@ -0,0 +1,186 @@
+/**
+ * @file validateChirpPurity.cpp
+ * @brief Utility program for validating the phase and magnitude purity of very long ChirpingPhasor runs.
+ *
+ * A single generator produces the run, chunk by chunk, exactly as an application would. Chunks are analyzed
+ * on a pool of threads as they are produced, each thread accumulating its own Phase and Magnitude Purity
+ * Analyzers over disjoint chunks, which are merged at the end. Memory is bounded by a small pool of chunk buffers,
+ * so runs of 10^10 samples and beyond may be validated.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+#include "ChirpPurityAnalysis.h"
+
+#include "CommandLineParser.h"
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // The number of samples of history which precede each chunk's samples within its buffer.
+    constexpr size_t historySize = 2;
+
+    // A chunk buffer. Its first historySize samples are the last samples of the chunk before it.
+    struct Chunk
+    {
+        std::unique_ptr< FlyingPhasorElementType[] > pBuffer;   // History followed by chunk samples.
+        size_t historyAvailable;                                // Valid history samples, fewer at the start of the run.
+    };
+
+    // A simple bounded hand off between the producer and analysis threads.
+    class ChunkQueue
+    {
+    public:
+        void push( Chunk * pChunk )
+        {
+            {
+                std::lock_guard< std::mutex > lock{ mutex };
+                chunks.push_back( pChunk );
+            }
+            condition.notify_one();
+        }
+
+        // Returns null once closed and drained.
+        Chunk * pop()
+        {
+            std::unique_lock< std::mutex > lock{ mutex };
+            condition.wait( lock, [this]() { return closed || !chunks.empty(); } );
+            if ( chunks.empty() ) return nullptr;
+            auto pChunk = chunks.front();
+            chunks.pop_front();
+            return pChunk;
+        }
+
+        void close()
+        {
+            {
+                std::lock_guard< std::mutex > lock{ mutex };
+                closed = true;
+            }
+            condition.notify_all();
+        }
+
+    private:
+        std::mutex mutex{};
+        std::condition_variable condition{};
+        std::deque< Chunk * > chunks{};
+        bool closed{ false };
+    };
+
+    void printStatistics( const char * name, const RunningStatistics & stats )
+    {
+        std::cout << name << ": count=" << stats.getCount() << " mean=" << stats.getMean()
+                  << " variance=" << stats.getVariance() << " maxNegDev=" << stats.getMaxNegDev()
+                  << " maxPosDev=" << stats.getMaxPosDev() << std::endl;
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    CommandLineParser cmdLineParser{};
+    if ( 0 != cmdLineParser.parseCommandLine( argc, argv ) || 0 == cmdLineParser.getChunkSize() ||
+         0 == cmdLineParser.getNumChunks() )
+    {
+        std::cerr << "validateChirpPurity Parse Error: Supports --accel, --omegaZero, --phi, --chunkSize, --numChunks "
+                  << "and --numThreads. The chunkSize and numChunks must be nonzero." << std::endl;
+        exit( 1 );
+    }
+
+    const auto accel = cmdLineParser.getAccel();
+    const auto omegaZero = cmdLineParser.getOmegaZero();
+    const auto phi = cmdLineParser.getPhi();
+    const auto chunkSize = size_t( cmdLineParser.getChunkSize() );
+    const auto numChunks = size_t( cmdLineParser.getNumChunks() );
+    auto numThreads = size_t( cmdLineParser.getNumThreads() );
+    if ( 0 == numThreads ) numThreads = std::max( 1U, std::thread::hardware_concurrency() );
+
+    std::cout.precision( 17 );
+    std::cout << "Samples: " << chunkSize * numChunks << ", Threads: " << numThreads << std::endl;
+
+    // The pool of chunk buffers bounds memory. Two per analysis thread keeps them busy while the producer fills.
+    std::vector< Chunk > pool( 2 * numThreads );
+    for ( auto & chunk : pool )
+        chunk.pBuffer.reset( new FlyingPhasorElementType[ historySize + chunkSize ] );
+    ChunkQueue freeQueue{};
+    ChunkQueue workQueue{};
+    for ( auto & chunk : pool )
+        freeQueue.push( &chunk );
+
+    // Each analysis thread accumulates its own analyzers, merged when all are done.
+    std::vector< PhasePurityAnalyzer > phaseAnalyzers( numThreads, PhasePurityAnalyzer{ accel } );
+    std::vector< MagPurityAnalyzer > magAnalyzers( numThreads );
+    std::vector< std::thread > threads{};
+    for ( size_t t = 0; numThreads != t; ++t )
+    {
+        threads.emplace_back( [&, t]() {
+            while ( auto pChunk = workQueue.pop() )
+            {
+                const auto pSamples = pChunk->pBuffer.get() + historySize;
+                phaseAnalyzers[t].restartStream();
+                phaseAnalyzers[t].addSamples( pSamples - pChunk->historyAvailable, pChunk->historyAvailable + chunkSize );
+                magAnalyzers[t].addSamples( pSamples, chunkSize );
+                freeQueue.push( pChunk );
+            }
+        } );
+    }
+
+    // Produce the run from a single generator, carrying history from each chunk to the next.
+    const auto start = std::chrono::steady_clock::now();
+    ChirpingPhasorToneGenerator chirpingPhasorToneGenerator{ accel, omegaZero, phi };
+    FlyingPhasorElementType history[ historySize ]{};
+    for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+    {
+        auto pChunk = freeQueue.pop();
+        auto pBuffer = pChunk->pBuffer.get();
+        std::copy( history, history + historySize, pBuffer );
+        chirpingPhasorToneGenerator.getSamples( pBuffer + historySize, chunkSize );
+        pChunk->historyAvailable = std::min( historySize, chunk * chunkSize );
+
+        // The history of a chunk smaller than the history spans the chunk before it.
+        for ( size_t i = 0; historySize != i; ++i )
+            history[i] = pBuffer[ chunkSize + i ];
+
+        workQueue.push( pChunk );
+    }
+    workQueue.close();
+    for ( auto & thread : threads )
+        thread.join();
+    const auto stop = std::chrono::steady_clock::now();
+
+    PhasePurityAnalyzer phasePurityAnalyzer{ accel };
+    MagPurityAnalyzer magPurityAnalyzer{};
+    for ( size_t t = 0; numThreads != t; ++t )
+    {
+        phasePurityAnalyzer.merge( phaseAnalyzers[t] );
+        magPurityAnalyzer.merge( magAnalyzers[t] );
+    }
+
+    const auto seconds = std::chrono::duration< double >( stop - start ).count();
+    std::cout << "Elapsed: " << seconds << " s, " << 1e9 * seconds / double( chunkSize * numChunks )
+              << " ns per sample" << std::endl;
+    printStatistics( "Acceleration (radsPerSample^2)", phasePurityAnalyzer.getStatistics() );
+    printStatistics( "Magnitude", magPurityAnalyzer.getStatistics() );
+
+    // The means are held to the tolerances of the chirpPurityTest.
+    const auto accelMean = phasePurityAnalyzer.getStatistics().getMean();
+    const auto magMean = magPurityAnalyzer.getStatistics().getMean();
+    const auto accelOk = chunkSize * numChunks < 3 || std::abs( accelMean - accel ) <= 1e-10 * std::abs( accel ) + 1e-20;
+    const auto magOk = std::abs( magMean - 1.0 ) <= 1e-15;
+    std::cout << ( accelOk && magOk ? "PASS" : "FAIL" ) << std::endl;
+
+    exit( accelOk && magOk ? 0 : 3 );
+    return 0;
+}
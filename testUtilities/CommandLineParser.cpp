@@ -11,7 +11,8 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
 //    int digitOptIndex = 0;
     int retCode = 0;
 
-    enum eOptions { Accel=1, OmegaZero=2, Phi=3, ChunkSize, NumChunks, SkipChunks, StreamFormat, Help, IncludeX };
+    enum eOptions { Accel=1, OmegaZero=2, Phi=3, ChunkSize, NumChunks, SkipChunks, StreamFormat, Help, IncludeX,
+                    ShmRing, RingSize, Snr, Seed, OutFile, LatencyHistogram, NumThreads };
 
     while (true) {
 //        int thisOptionOptIndex = optind ? optind : 1;
@@ -26,6 +27,13 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
                 { "streamFormat", required_argument, nullptr, StreamFormat },
                 { "help", no_argument, nullptr, Help },
                 { "includeX", no_argument, nullptr, IncludeX },
+                { "shmRing", required_argument, nullptr, ShmRing },
+                { "ringSize", required_argument, nullptr, RingSize },
+                { "snr", required_argument, nullptr, Snr },
+                { "seed", required_argument, nullptr, Seed },
+                { "outFile", required_argument, nullptr, OutFile },
+                { "latencyHistogram", no_argument, nullptr, LatencyHistogram },
+                { "numThreads", required_argument, nullptr, NumThreads },
                 { nullptr, 0, nullptr, 0 }
         };
 
@@ -71,6 +79,18 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
                     streamFormatIn = StreamFormat::Bin32;
                 else if ( streamFormatStr == "b64" )
                     streamFormatIn = StreamFormat::Bin64;
+                else if ( streamFormatStr == "r32" )
+                    streamFormatIn = StreamFormat::Real32;
+                else if ( streamFormatStr == "r64" )
+                    streamFormatIn = StreamFormat::Real64;
+                else if ( streamFormatStr == "npy32" )
+                    streamFormatIn = StreamFormat::Npy32;
+                else if ( streamFormatStr == "npy64" || streamFormatStr == "npy" )
+                    streamFormatIn = StreamFormat::Npy64;
+                else if ( streamFormatStr == "sigmf32" )
+                    streamFormatIn = StreamFormat::SigMF32;
+                else if ( streamFormatStr == "sigmf64" || streamFormatStr == "sigmf" )
+                    streamFormatIn = StreamFormat::SigMF64;
                 else
                     streamFormatIn = StreamFormat::Invalid;
                 break;
@@ -84,6 +104,35 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
                 includeX_In = true;
                 break;
 
+            case ShmRing:
+                shmRingIn = optarg;
+                break;
+
+            case RingSize:
+                ringSizeIn = std::stoul( optarg );
+                break;
+
+            case Snr:
+                snrIn = std::stod( optarg );
+                snrSpecifiedIn = true;
+                break;
+
+            case Seed:
+                seedIn = std::stoull( optarg );
+                break;
+
+            case OutFile:
+                outFileIn = optarg;
+                break;
+
+            case LatencyHistogram:
+                latencyHistogramIn = true;
+                break;
+
+            case NumThreads:
+                numThreadsIn = std::stoul( optarg );
+                break;
+
             case '?':
 //                std::cout << "The getopt_long call returned '?'" << std::endl;
                 retCode = 1;
@@ -4,6 +4,7 @@
 #define REISER_RT_CHIRPINGPHASORCOMMANDLINEPARSER_H
 
 #include <cmath>
+#include <string>
 
 class CommandLineParser
 {
@@ -21,12 +22,26 @@ public:
     inline unsigned long getNumChunks() const { return numChunksIn; }
     inline unsigned long getSkipChunks() const { return skipChunksIn; }
 
-    enum class StreamFormat : short { Invalid=0, Text32, Text64, Bin32, Bin64 };
+    enum class StreamFormat : short { Invalid=0, Text32, Text64, Bin32, Bin64, Real32, Real64,
+                                      Npy32, Npy64, SigMF32, SigMF64 };
     StreamFormat getStreamFormat() const { return streamFormatIn; }
 
     inline bool getHelpFlag() const { return helpFlagIn; }
     inline bool getIncludeX() const { return includeX_In; }
 
+    inline const std::string & getShmRing() const { return shmRingIn; }
+    inline unsigned long getRingSize() const { return ringSizeIn; }
+
+    inline bool getSnrSpecified() const { return snrSpecifiedIn; }
+    inline double getSnr() const { return snrIn; }
+    inline unsigned long long getSeed() const { return seedIn; }
+
+    inline const std::string & getOutFile() const { return outFileIn; }
+
+    inline bool getLatencyHistogram() const { return latencyHistogramIn; }
+
+    inline unsigned long getNumThreads() const { return numThreadsIn; }
+
 private:
     double accelIn{ M_PI / 16384 };
     double omegaZeroIn{ 0.0 };
@@ -36,6 +51,14 @@ private:
     unsigned long skipChunksIn{ 0 };
     bool helpFlagIn{ false };
     bool includeX_In{ false };
+    std::string shmRingIn{};
+    unsigned long ringSizeIn{ 1048576 };
+    bool snrSpecifiedIn{ false };
+    double snrIn{ 0.0 };
+    unsigned long long seedIn{ 0 };
+    std::string outFileIn{};
+    bool latencyHistogramIn{ false };
+    unsigned long numThreadsIn{ 0 };
 
     StreamFormat streamFormatIn{ StreamFormat::Text64 };
 };
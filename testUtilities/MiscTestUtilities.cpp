@@ -1,6 +1,7 @@
 // Created on 20220108
 
 #include "MiscTestUtilities.h"
+#include <algorithm>
 #include <cmath>
 
 bool inTolerance( double value, double desiredValue, double toleranceRatio )
@@ -20,3 +21,47 @@ double deltaAngle( double angleA, double angleB )
     else if ( delta < -M_PI ) delta += 2*M_PI;
     return delta;
 }
+
+double seedDivergenceBound( size_t n )
+{
+    const auto x = double( n );
+    return ( 1.0 + x + x * x / 2.0 ) * 1.6e-16;
+}
+
+double maxError( const std::vector< std::complex< double > > & a, const std::vector< std::complex< double > > & b )
+{
+    double err = 0.0;
+    for ( size_t n = 0; a.size() != n; ++n ) err = std::max( err, std::abs( a[n] - b[n] ) );
+    return err;
+}
+
+void directCorrelation( const std::vector< std::complex< double > > & reference,
+                        const std::complex< double > * pInput, size_t numSamples, std::complex< double > * pOutput )
+{
+    for ( size_t n = 0; numSamples != n; ++n )
+    {
+        double re = 0.0;
+        double im = 0.0;
+        const auto numTerms = std::min( reference.size(), numSamples - n );
+        for ( size_t k = 0; numTerms != k; ++k )
+        {
+            const auto & r = reference[k];
+            const auto & x = pInput[ n + k ];
+            re += r.real() * x.real() + r.imag() * x.imag();
+            im += r.real() * x.imag() - r.imag() * x.real();
+        }
+        pOutput[n] = std::complex< double >{ re, im };
+    }
+}
+
+uint32_t lcgNext( uint32_t & state )
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+std::complex< double > exactSample( double accel, double omegaZero, double phi, long double t )
+{
+    const long double theta = phi + omegaZero * t + 0.5L * accel * t * t;
+    return std::polar( 1.0, double( std::fmod( theta, 2.0L * 3.14159265358979323846264338327950288L ) ) );
+}
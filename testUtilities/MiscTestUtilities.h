@@ -3,8 +3,32 @@
 #ifndef REISER_RT_CHRIPINGPHASORTONEGEN_MISCTESTUTILITIES_H
 #define REISER_RT_CHRIPINGPHASORTONEGEN_MISCTESTUTILITIES_H
 
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 bool inTolerance( double value, double desiredValue, double toleranceRatio );
 
 double deltaAngle( double angleA, double angleB );
 
+// Bound upon how far sample n of two chirp recursions may diverge when each of their three starting phasors
+// (phase, rate and acceleration) differs by up to an ulp. The rate difference accumulates linearly
+// and the acceleration difference quadratically.
+double seedDivergenceBound( size_t n );
+
+// The largest magnitude of the sample by sample differences of two equally sized series.
+double maxError( const std::vector< std::complex< double > > & a, const std::vector< std::complex< double > > & b );
+
+// Direct correlation, sum over k of conj( ref(k) ) * x( n + k ), with x zero beyond its end.
+void directCorrelation( const std::vector< std::complex< double > > & reference,
+                        const std::complex< double > * pInput, size_t numSamples, std::complex< double > * pOutput );
+
+// Advances a linear congruential generator state (Numerical Recipes constants) and returns the new state.
+// A deterministic source of pseudo random test inputs.
+uint32_t lcgNext( uint32_t & state );
+
+// Closed form chirp sample at time t in samples, computed in long double and reduced modulo two pi.
+std::complex< double > exactSample( double accel, double omegaZero, double phi, long double t );
+
 #endif //REISER_RT_CHRIPINGPHASORTONEGEN_MISCTESTUTILITIES_H
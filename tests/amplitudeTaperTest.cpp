@@ -0,0 +1,103 @@
+/**
+ * @file amplitudeTaperTest.cpp
+ * @brief Verifies the Amplitude Tapers against their textbook definitions and the tapered generation
+ * of the ChirpingPhasorToneGenerator against an untapered series multiplied by the taper.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "AmplitudeTaper.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t LENGTH = 3001;
+    constexpr auto accel = M_PI / 8192;
+    constexpr auto omegaZero = -1.0;
+    constexpr auto phi = 0.2;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        // Textbook definitions.
+        const auto hann = AmplitudeTaper::hann( LENGTH );
+        const auto hamming = AmplitudeTaper::hamming( LENGTH );
+        const auto tukey = AmplitudeTaper::tukey( LENGTH, 0.25 );
+        double maxDefErr = 0.0;
+        for ( size_t n = 0; LENGTH != n; ++n )
+        {
+            const auto x = 2.0 * M_PI * double( n ) / double( LENGTH - 1 );
+            maxDefErr = std::max( maxDefErr, std::abs( hann.valueAt( n ) - ( 0.5 - 0.5 * std::cos( x ) ) ) );
+            maxDefErr = std::max( maxDefErr, std::abs( hamming.valueAt( n ) - ( 0.54 - 0.46 * std::cos( x ) ) ) );
+
+            // Tukey, as defined by SciPy.
+            const auto span = 0.25 * double( LENGTH - 1 );
+            const auto width = size_t( std::floor( span / 2.0 ) );
+            double w = 1.0;
+            if ( n <= width )
+                w = 0.5 * ( 1.0 + std::cos( M_PI * ( -1.0 + 2.0 * double( n ) / span ) ) );
+            else if ( n >= LENGTH - width - 1 )
+                w = 0.5 * ( 1.0 + std::cos( M_PI * ( -2.0 / 0.25 + 1.0 + 2.0 * double( n ) / span ) ) );
+            maxDefErr = std::max( maxDefErr, std::abs( tukey.valueAt( n ) - w ) );
+        }
+        std::cout << "Definition Max Error: " << maxDefErr << std::endl;
+        if ( maxDefErr > 1e-12 || 3 != tukey.getNumSegments() || 0.0 != hann.valueAt( LENGTH ) )
+        {
+            std::cout << "Tapers disagree with their definitions" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Taylor, symmetric with unit peak and edges well below the peak.
+        const auto taylor = AmplitudeTaper::taylor( LENGTH, 5, 35.0 );
+        const auto peak = taylor.valueAt( LENGTH / 2 );
+        double maxAsymmetry = 0.0;
+        for ( size_t n = 0; LENGTH != n; ++n )
+            maxAsymmetry = std::max( maxAsymmetry, std::abs( taylor.valueAt( n ) - taylor.valueAt( LENGTH - 1 - n ) ) );
+        std::cout << "Taylor Peak: " << peak << ", Edge: " << taylor.valueAt( 0 )
+                  << ", Asymmetry: " << maxAsymmetry << std::endl;
+        if ( std::abs( peak - 1.0 ) > 1e-12 || maxAsymmetry > 1e-12 || taylor.valueAt( 0 ) > 0.5 )
+        {
+            std::cout << "Taylor taper is malformed" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Tapered generation, split across invocations and running past the end of the taper.
+        ChirpingPhasorToneGenerator plainGen{ accel, omegaZero, phi };
+        std::vector< FlyingPhasorElementType > plain( LENGTH + 100 );
+        plainGen.getSamples( plain.data(), plain.size() );
+        for ( const auto * pTaper : { &hann, &hamming, &tukey, &taylor } )
+        {
+            ChirpingPhasorToneGenerator taperGen{ accel, omegaZero, phi };
+            std::vector< FlyingPhasorElementType > tapered( LENGTH + 100 );
+            taperGen.getSamplesTapered( tapered.data(), 1000, *pTaper );
+            taperGen.getSamplesTapered( tapered.data() + 1000, LENGTH + 100 - 1000, *pTaper, 1000 );
+
+            double maxErr = 0.0;
+            for ( size_t n = 0; tapered.size() != n; ++n )
+                maxErr = std::max( maxErr, std::abs( tapered[n] - plain[n] * pTaper->valueAt( n ) ) );
+            std::cout << "Tapered Generation Max Error: " << maxErr << std::endl;
+            if ( maxErr > 1e-12 || tapered.size() != taperGen.getSampleCount() )
+            {
+                std::cout << "Tapered generation disagrees with the taper" << std::endl;
+                retCode = 3;
+                break;
+            }
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file chirpArrayFanOutTest.cpp
+ * @brief Verifies the Chirp Array Fan Out against the closed form of individually steered elements.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpArrayFanOut.h"
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t NUM_ELEMENTS = 16;
+    constexpr size_t CALL_SIZES[] = { 1000, 777, 300 };
+    constexpr size_t NUM_SAMPLES = 1000 + 777 + 300;
+    constexpr auto accel = M_PI / 2048;
+    constexpr auto omegaZero = 0.2;
+    constexpr auto phi = -0.4;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    std::vector< ChirpArrayFanOut::ElementSteering > steering( NUM_ELEMENTS );
+    for ( size_t e = 0; NUM_ELEMENTS != e; ++e )
+        steering[e] = ChirpArrayFanOut::ElementSteering{ 0.3 * double( e ), 1.37 * double( e ) };
+
+    // Expected output from the closed form. Element e at sample n is silent until its integer delay has elapsed
+    // and is, exp( j * ( phase + theta( n - delay ) ) ), thereafter.
+    std::vector< FlyingPhasorElementType > expected( NUM_ELEMENTS * NUM_SAMPLES );
+    for ( size_t e = 0; NUM_ELEMENTS != e; ++e )
+    {
+        for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+        {
+            const long double x = (long double)( n ) - steering[e].delay;
+            if ( double( n ) < std::floor( steering[e].delay ) ) continue;
+            const auto theta = steering[e].phase + phi + omegaZero * x + accel / 2.0L * x * x;
+            expected[ e * NUM_SAMPLES + n ] = std::polar( 1.0, double( std::fmod( theta, 2.0L * M_PI ) ) );
+        }
+    }
+
+    const ChirpArrayFanOut::Layout layouts[] = { ChirpArrayFanOut::Layout::ElementMajor,
+                                                 ChirpArrayFanOut::Layout::TimeMajor };
+    ChirpArrayFanOut fanOut{ accel, omegaZero, phi, steering.data(), NUM_ELEMENTS };
+    for ( const auto layout : layouts )
+    {
+        fanOut.reset();
+
+        // Deliver in several calls of varying size, gathering into an element major series.
+        std::vector< FlyingPhasorElementType > actual( NUM_ELEMENTS * NUM_SAMPLES );
+        std::vector< FlyingPhasorElementType > callBuf( NUM_ELEMENTS * NUM_SAMPLES );
+        size_t start = 0;
+        for ( const auto callSize : CALL_SIZES )
+        {
+            fanOut.getSamples( callBuf.data(), callSize, layout );
+            for ( size_t e = 0; NUM_ELEMENTS != e; ++e )
+            {
+                for ( size_t t = 0; callSize != t; ++t )
+                {
+                    actual[ e * NUM_SAMPLES + start + t ] = ChirpArrayFanOut::Layout::ElementMajor == layout ?
+                        callBuf[ e * callSize + t ] : callBuf[ t * NUM_ELEMENTS + e ];
+                }
+            }
+            start += callSize;
+        }
+
+        if ( NUM_SAMPLES != fanOut.getSampleCount() || NUM_ELEMENTS != fanOut.getNumElements() )
+        {
+            std::cout << "Sample Count should be " << NUM_SAMPLES << " and is " << fanOut.getSampleCount() << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        double maxErr = 0.0;
+        for ( size_t i = 0; actual.size() != i; ++i )
+            maxErr = std::max( maxErr, std::abs( actual[i] - expected[i] ) );
+        std::cout << "Layout " << int( layout ) << " Max Error: " << maxErr << std::endl;
+        if ( maxErr > 1e-10 )
+        {
+            std::cout << "Fan Out Error out of Tolerance! Should be less than: " << 1e-10 << std::endl;
+            retCode = 2;
+            break;
+        }
+    }
+
+    exit( retCode );
+    return retCode;
+}
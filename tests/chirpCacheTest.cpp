@@ -0,0 +1,169 @@
+/**
+ * @file chirpCacheTest.cpp
+ * @brief Verifies the Chirp Cache hit, miss, eviction, phase offset and concurrent access behaviors.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpCache.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t PULSE_LENGTH = 1024;
+    constexpr size_t BLOCK_BYTES = PULSE_LENGTH * sizeof( FlyingPhasorElementType ) + 63;
+    constexpr auto accel = M_PI / 4096;
+    constexpr auto omegaZero = 0.1;
+    constexpr auto phi = 0.2;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        // Budget for two pulses.
+        ChirpCache cache{ 2 * BLOCK_BYTES };
+
+        std::unique_ptr< FlyingPhasorElementType[] > pExpected{ new FlyingPhasorElementType[ PULSE_LENGTH ] };
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        chirpGen.getSamples( pExpected.get(), PULSE_LENGTH );
+
+        // A miss followed by a hit, both delivering exactly what the generator would.
+        const auto spanA = cache.getPulse( accel, omegaZero, phi, PULSE_LENGTH );
+        const auto spanA2 = cache.getPulse( accel, omegaZero, phi, PULSE_LENGTH );
+        if ( 1 != cache.getMissCount() || 1 != cache.getHitCount() || spanA.data() != spanA2.data() )
+        {
+            std::cout << "Expected one miss and one hit sharing a block. Misses: " << cache.getMissCount()
+                      << ", Hits: " << cache.getHitCount() << std::endl;
+            retCode = 1;
+            break;
+        }
+        if ( 0 != reinterpret_cast< uintptr_t >( spanA.data() ) % 64 || PULSE_LENGTH != spanA.size() )
+        {
+            std::cout << "Pulse block is not 64 byte aligned or has the wrong size." << std::endl;
+            retCode = 2;
+            break;
+        }
+        for ( size_t i = 0; PULSE_LENGTH != i; ++i )
+        {
+            if ( spanA[i] != pExpected[i] )
+            {
+                std::cout << "Cached Sample differs at index " << i << ". Expected " << pExpected[i]
+                          << ", obtained " << spanA[i] << std::endl;
+                retCode = 3;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Least recently used eviction. Touch A after B so that C evicts B.
+        cache.getPulse( accel, omegaZero, -phi, PULSE_LENGTH );
+        cache.getPulse( accel, omegaZero, phi, PULSE_LENGTH );
+        cache.getPulse( accel, -omegaZero, phi, PULSE_LENGTH );
+        if ( 2 * BLOCK_BYTES != cache.getBytesCached() )
+        {
+            std::cout << "Bytes Cached should be " << 2 * BLOCK_BYTES << " and is " << cache.getBytesCached()
+                      << std::endl;
+            retCode = 4;
+            break;
+        }
+        auto misses = cache.getMissCount();
+        cache.getPulse( accel, omegaZero, phi, PULSE_LENGTH );
+        if ( misses != cache.getMissCount() )
+        {
+            std::cout << "Most recently used pulse was evicted." << std::endl;
+            retCode = 5;
+            break;
+        }
+        cache.getPulse( accel, omegaZero, -phi, PULSE_LENGTH );
+        if ( misses + 1 != cache.getMissCount() )
+        {
+            std::cout << "Least recently used pulse was not evicted." << std::endl;
+            retCode = 6;
+            break;
+        }
+
+        // Spans outlive eviction and clearing.
+        cache.clear();
+        if ( 0 != cache.getBytesCached() || 0 != cache.getHitCount() || spanA[1] != pExpected[1] )
+        {
+            std::cout << "Clear failed or span invalidated." << std::endl;
+            retCode = 7;
+            break;
+        }
+
+        // Phase offset lookup agrees with the generator to within rounding.
+        const auto spanR = cache.getPulsePhaseOffset( accel, omegaZero, phi, PULSE_LENGTH );
+        for ( size_t i = 0; PULSE_LENGTH != i; ++i )
+        {
+            if ( std::abs( spanR[i] - pExpected[i] ) > 1e-13 )
+            {
+                std::cout << "Phase Offset Sample differs at index " << i << ". Expected " << pExpected[i]
+                          << ", obtained " << spanR[i] << std::endl;
+                retCode = 8;
+                break;
+            }
+        }
+        if ( retCode ) break;
+        if ( 1 != cache.getMissCount() || 0 != cache.getHitCount() || 2 * BLOCK_BYTES != cache.getBytesCached() )
+        {
+            std::cout << "Phase Offset miss should count once and retain the base and rotated pulses. Misses: "
+                      << cache.getMissCount() << ", Bytes Cached: " << cache.getBytesCached() << std::endl;
+            retCode = 12;
+            break;
+        }
+        cache.getPulsePhaseOffset( accel, omegaZero, phi, PULSE_LENGTH );
+        if ( 1 != cache.getHitCount() )
+        {
+            std::cout << "Phase Offset Pulse was not cached." << std::endl;
+            retCode = 9;
+            break;
+        }
+
+        // Concurrent access. Every thread must observe identical samples.
+        cache.clear();
+        constexpr size_t NUM_THREADS = 4;
+        constexpr size_t NUM_REQUESTS = 100;
+        std::vector< ChirpSpan > spans( NUM_THREADS * NUM_REQUESTS );
+        std::vector< std::thread > threads;
+        for ( size_t t = 0; NUM_THREADS != t; ++t )
+        {
+            threads.emplace_back( [ &cache, &spans, t ]() {
+                for ( size_t r = 0; NUM_REQUESTS != r; ++r )
+                    spans[ t * NUM_REQUESTS + r ] = cache.getPulse( accel, omegaZero, phi + double( r % 3 ), PULSE_LENGTH );
+            } );
+        }
+        for ( auto & thread : threads ) thread.join();
+        if ( NUM_THREADS * NUM_REQUESTS != cache.getHitCount() + cache.getMissCount() )
+        {
+            std::cout << "Hit plus Miss Count should be " << NUM_THREADS * NUM_REQUESTS << std::endl;
+            retCode = 10;
+            break;
+        }
+        for ( size_t i = 0; spans.size() != i; ++i )
+        {
+            if ( spans[i][ PULSE_LENGTH - 1 ] != spans[ i % NUM_REQUESTS ][ PULSE_LENGTH - 1 ] )
+            {
+                std::cout << "Concurrent spans disagree at request " << i << std::endl;
+                retCode = 11;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
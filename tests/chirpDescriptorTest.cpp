@@ -0,0 +1,116 @@
+/**
+ * @file chirpDescriptorTest.cpp
+ * @brief Verifies that arming from Chirp Descriptors, singly or in batches, agrees with resetting.
+ *
+ * The starting phasors of descriptors come from a batch sine and cosine, within an ulp of those of the
+ * reset operation, so agreement is to within the divergence such seed differences allow.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpDescriptor.h"
+#include "MiscTestUtilities.h"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    bool agrees( const std::vector< FlyingPhasorElementType > & expected,
+                 const std::vector< FlyingPhasorElementType > & actual )
+    {
+        for ( size_t n = 0; expected.size() != n; ++n )
+            if ( std::abs( expected[n] - actual[n] ) > seedDivergenceBound( n ) ) return false;
+        return true;
+    }
+}
+
+int main()
+{
+    constexpr size_t NUM_CHIRPS = 150;
+    constexpr size_t NUM_SAMPLES = 3000;
+    constexpr size_t RESYNC_INTERVAL = 1000;
+
+    int retCode = 0;
+
+    // A structure of arrays parameter table.
+    std::vector< double > accels( NUM_CHIRPS );
+    std::vector< double > omegaZeros( NUM_CHIRPS );
+    std::vector< double > phis( NUM_CHIRPS );
+    for ( size_t i = 0; NUM_CHIRPS != i; ++i )
+    {
+        accels[i] = M_PI / double( 4096 + 37 * i ) * ( i & 0x1 ? -1.0 : 1.0 );
+        omegaZeros[i] = -3.0 + 0.04 * double( i );
+        phis[i] = -7.0 + 0.1 * double( i );
+    }
+
+    std::vector< ChirpDescriptor > descriptors( NUM_CHIRPS );
+    ChirpDescriptor::makeBatch( accels.data(), omegaZeros.data(), phis.data(), NUM_CHIRPS, descriptors.data() );
+
+    std::vector< FlyingPhasorElementType > expected( NUM_SAMPLES );
+    std::vector< FlyingPhasorElementType > actual( NUM_SAMPLES );
+    do
+    {
+        // Batch made descriptors must match individually made ones, and arming must match resetting.
+        // Generators are used beforehand so that arming has state to overwrite.
+        ChirpingPhasorToneGenerator resetGen{ 0.01, 0.2, 0.3 };
+        ChirpingPhasorToneGenerator armGen{ 0.04, 0.5, 0.6 };
+        resetGen.setResyncInterval( RESYNC_INTERVAL );
+        armGen.setResyncInterval( RESYNC_INTERVAL );
+        for ( size_t i = 0; NUM_CHIRPS != i; ++i )
+        {
+            const ChirpDescriptor descriptor{ accels[i], omegaZeros[i], phis[i] };
+            if ( 0 != std::memcmp( &descriptor.getInitialState(), &descriptors[i].getInitialState(),
+                                   sizeof( ChirpingPhasorToneGenerator::StateSnapshot ) ) ||
+                 descriptor.getAccel() != descriptors[i].getAccel() ||
+                 descriptor.getOmegaZero() != descriptors[i].getOmegaZero() ||
+                 descriptor.getPhi() != descriptors[i].getPhi() )
+            {
+                std::cout << "Batch descriptor " << i << " differs from individual descriptor" << std::endl;
+                retCode = 1;
+                break;
+            }
+
+            resetGen.getSamples( expected.data(), 17 );
+            armGen.getSamples( actual.data(), 29 );
+            resetGen.reset( accels[i], omegaZeros[i], phis[i] );
+            descriptors[i].arm( armGen );
+            resetGen.getSamples( expected.data(), NUM_SAMPLES );
+            armGen.getSamples( actual.data(), NUM_SAMPLES );
+            if ( !agrees( expected, actual ) || RESYNC_INTERVAL != armGen.getResyncInterval() )
+            {
+                std::cout << "Armed generator " << i << " differs from reset generator" << std::endl;
+                retCode = 2;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Generators armed from a batch of descriptors must match individual resets.
+        std::vector< ChirpingPhasorToneGenerator > resetGens( NUM_CHIRPS );
+        std::vector< ChirpingPhasorToneGenerator > batchGens( NUM_CHIRPS, ChirpingPhasorToneGenerator{ 0.1, 0.2, 0.3 } );
+        for ( size_t i = 0; NUM_CHIRPS != i; ++i )
+            resetGens[i].reset( accels[i], omegaZeros[i], phis[i] );
+        for ( size_t i = 0; NUM_CHIRPS != i; ++i )
+            descriptors[i].arm( batchGens[i] );
+        for ( size_t i = 0; NUM_CHIRPS != i; ++i )
+        {
+            resetGens[i].getSamples( expected.data(), NUM_SAMPLES );
+            batchGens[i].getSamples( actual.data(), NUM_SAMPLES );
+            if ( !agrees( expected, actual ) )
+            {
+                std::cout << "Batch reset generator " << i << " differs from reset generator" << std::endl;
+                retCode = 3;
+                break;
+            }
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file chirpHopSequenceTest.cpp
+ * @brief Verifies the Chirp Hop Sequence Generator against the closed form phase of each phase mode.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpHopSequenceGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    using Hop = ChirpHopSequenceGenerator::Hop;
+    using PhaseMode = ChirpHopSequenceGenerator::PhaseMode;
+
+    // Tones and chirps, up and down, with odd and even dwells so that hops begin on either re-normalization phase.
+    const Hop hops[] = {
+        { 0.25, 0.0, 1000 },
+        { -1.5, M_PI / 4096.0, 1537 },
+        { 2.75, -M_PI / 2048.0, 999 },
+        { 1.0, 0.0, 1 },
+        { -0.5, M_PI / 8192.0, 2048 },
+    };
+    constexpr size_t numHops = sizeof( hops ) / sizeof( hops[0] );
+    constexpr double phi = 0.7;
+    constexpr size_t numCycles = 3;
+
+    // The closed form phase of every sample of the sequence, in long double and reduced modulo two pi.
+    std::vector< long double > closedFormPhase( PhaseMode phaseMode )
+    {
+        const long double twoPi = 2.0L * 3.141592653589793238462643383279502884L;
+        std::vector< long double > phase;
+        long double hopStartPhase = phi;
+        size_t n = 0;
+        for ( size_t cycle = 0; numCycles != cycle; ++cycle )
+        {
+            for ( const auto & hop : hops )
+            {
+                if ( PhaseMode::Coherent == phaseMode )
+                    hopStartPhase = std::fmod( phi + (long double)hop.omegaZero * (long double)n, twoPi );
+
+                for ( size_t k = 0; hop.dwell != k; ++k )
+                {
+                    const auto m = (long double)k;
+                    phase.push_back( std::fmod( hopStartPhase + (long double)hop.omegaZero * m
+                                                + (long double)hop.accel / 2.0L * m * m, twoPi ) );
+                }
+
+                // The phase of the sample which would have followed, where the next hop continues.
+                const auto d = (long double)hop.dwell;
+                hopStartPhase = std::fmod( hopStartPhase + (long double)hop.omegaZero * d
+                                           + (long double)hop.accel / 2.0L * d * d, twoPi );
+                n += hop.dwell;
+            }
+        }
+        return phase;
+    }
+
+    double maxError( const std::vector< FlyingPhasorElementType > & samples, const std::vector< long double > & phase )
+    {
+        double err = 0.0;
+        for ( size_t n = 0; samples.size() != n; ++n )
+            err = std::max( err, std::abs( samples[n] - std::polar( 1.0, double( phase[n] ) ) ) );
+        return err;
+    }
+}
+
+int main()
+{
+    constexpr double TOLERANCE = 5e-11;
+    constexpr size_t CALL_SIZES[] = { 1, 2, 999, 1000, 1537, 3 };
+
+    int retCode = 0;
+
+    do
+    {
+        for ( const auto phaseMode : { PhaseMode::Continuous, PhaseMode::Coherent } )
+        {
+            const char * modeName = PhaseMode::Coherent == phaseMode ? "Coherent" : "Continuous";
+            ChirpHopSequenceGenerator generator{ hops, numHops, phaseMode, phi };
+
+            size_t cycleLength = 0;
+            for ( const auto & hop : hops ) cycleLength += hop.dwell;
+            if ( generator.getNumHops() != numHops || generator.getCycleLength() != cycleLength )
+            {
+                std::cout << modeName << ": Unexpected hop count or cycle length." << std::endl;
+                retCode = 1;
+                break;
+            }
+
+            // Several cycles, in a single request, against the closed form.
+            const auto phase = closedFormPhase( phaseMode );
+            std::vector< FlyingPhasorElementType > whole( phase.size() );
+            generator.getSamples( whole.data(), whole.size() );
+            const auto err = maxError( whole, phase );
+            if ( TOLERANCE < err )
+            {
+                std::cout << modeName << ": Closed form error of " << err << " exceeds tolerance." << std::endl;
+                retCode = 2;
+                break;
+            }
+            if ( generator.getSampleCount() != whole.size() || generator.getHopIndex() != 0 )
+            {
+                std::cout << modeName << ": Unexpected sample count or hop index after complete cycles." << std::endl;
+                retCode = 3;
+                break;
+            }
+
+            // The same, after reset, in requests of assorted sizes straddling hop boundaries, must be identical.
+            generator.reset();
+            std::vector< FlyingPhasorElementType > split( whole.size() );
+            size_t i = 0;
+            for ( size_t n = 0; split.size() != n; ++i )
+            {
+                const auto count = std::min( CALL_SIZES[ i % ( sizeof( CALL_SIZES ) / sizeof( CALL_SIZES[0] ) ) ],
+                                             split.size() - n );
+                generator.getSamples( split.data() + n, count );
+                n += count;
+            }
+            if ( split != whole )
+            {
+                std::cout << modeName << ": Split requests differ from a single request." << std::endl;
+                retCode = 4;
+                break;
+            }
+
+            // The hop index follows the dwells.
+            generator.reset();
+            generator.getSamples( split.data(), hops[0].dwell + hops[1].dwell - 1 );
+            const auto indexWithin = generator.getHopIndex();
+            generator.getSamples( split.data(), 1 );
+            const auto indexAfter = generator.getHopIndex();
+            if ( 1 != indexWithin || 2 != indexAfter )
+            {
+                std::cout << modeName << ": Unexpected hop indices " << indexWithin << " and " << indexAfter << std::endl;
+                retCode = 5;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Invalid hop tables.
+        const Hop zeroDwell[] = { { 0.1, 0.0, 10 }, { 0.2, 0.0, 0 } };
+        bool threwEmpty = false;
+        bool threwZeroDwell = false;
+        try { ChirpHopSequenceGenerator generator{ hops, 0 }; }
+        catch ( const std::invalid_argument & ) { threwEmpty = true; }
+        try { ChirpHopSequenceGenerator generator{ zeroDwell, 2 }; }
+        catch ( const std::invalid_argument & ) { threwZeroDwell = true; }
+        if ( !threwEmpty || !threwZeroDwell )
+        {
+            std::cout << "Invalid hop tables were not rejected." << std::endl;
+            retCode = 6;
+            break;
+        }
+    } while ( false );
+
+    exit( retCode );
+    return retCode;
+}
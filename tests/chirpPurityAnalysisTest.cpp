@@ -0,0 +1,147 @@
+/**
+ * @file chirpPurityAnalysisTest.cpp
+ * @brief Verifies that the Chirp Purity Analysis components give the same result whether a series is analyzed
+ * whole, streamed in chunks, or split into disjoint ranges which are merged.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpPurityAnalysis.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    bool sameStatistics( const RunningStatistics & a, const RunningStatistics & b, double tolerance )
+    {
+        auto close = [tolerance]( double x, double y ) { return std::abs( x - y ) <= tolerance * std::abs( y ); };
+        return a.getCount() == b.getCount() && close( a.getMean(), b.getMean() )
+            && close( a.getVariance(), b.getVariance() )
+            && std::abs( a.getMaxNegDev() - b.getMaxNegDev() ) <= 1e-3 * std::abs( b.getMaxNegDev() ) + 1e-30
+            && std::abs( a.getMaxPosDev() - b.getMaxPosDev() ) <= 1e-3 * std::abs( b.getMaxPosDev() ) + 1e-30;
+    }
+}
+
+int main()
+{
+    constexpr size_t NUM_SAMPLES = 100000;
+    constexpr auto accel = M_PI / 16384;
+
+    int retCode = 0;
+
+    std::cout.precision(17);
+
+    do
+    {
+        // Running statistics against a two pass computation, and merging of three parts.
+        {
+            std::vector< double > values( 1001 );
+            for ( size_t n = 0; values.size() != n; ++n )
+                values[n] = 5.0 + 1e-12 * std::sin( double( n ) * 0.7 );
+            long double sum = 0.0L;
+            for ( auto v : values ) sum += v;
+            const auto mean = sum / values.size();
+            long double sumSq = 0.0L;
+            for ( auto v : values ) sumSq += ( v - mean ) * ( v - mean );
+            const auto variance = double( sumSq / ( values.size() - 1 ) );
+
+            RunningStatistics whole{ 5.0 }, a{ 5.0 }, b{ 5.0 }, c{ 5.0 };
+            for ( size_t n = 0; values.size() != n; ++n )
+            {
+                whole.addSample( values[n] );
+                ( n < 100 ? a : n < 700 ? b : c ).addSample( values[n] );
+            }
+            b.merge( c );
+            a.merge( b );
+            std::cout << "Two Pass Variance: " << variance << ", Running: " << whole.getVariance()
+                      << ", Merged: " << a.getVariance() << std::endl;
+            if ( std::abs( whole.getVariance() - variance ) > 1e-9 * variance || !sameStatistics( a, whole, 1e-9 ) )
+            {
+                std::cout << "Running statistics disagree with the two pass computation" << std::endl;
+                retCode = 1;
+                break;
+            }
+
+            bool threw = false;
+            try { a.merge( RunningStatistics{ 0.0 } ); }
+            catch ( const std::invalid_argument & ) { threw = true; }
+            if ( !threw )
+            {
+                std::cout << "Expected invalid_argument merging differing origins" << std::endl;
+                retCode = 2;
+                break;
+            }
+        }
+
+        // A chirp which rolls over the nyquist rate part way through.
+        ChirpingPhasorToneGenerator chirpingPhasorToneGenerator{ accel, -M_PI / 2.0 };
+        std::vector< FlyingPhasorElementType > samples( NUM_SAMPLES );
+        chirpingPhasorToneGenerator.getSamples( samples.data(), samples.size() );
+
+        PhasePurityAnalyzer wholePhase{ accel };
+        MagPurityAnalyzer wholeMag{};
+        wholePhase.addSamples( samples.data(), samples.size() );
+        wholeMag.addSamples( samples.data(), samples.size() );
+        std::cout << "Acceleration Mean: " << wholePhase.getStatistics().getMean()
+                  << ", Variance: " << wholePhase.getStatistics().getVariance() << std::endl;
+        if ( NUM_SAMPLES - 2 != wholePhase.getStatistics().getCount()
+          || std::abs( wholePhase.getStatistics().getMean() - accel ) > 1e-10 * accel
+          || wholePhase.getStatistics().getVariance() > 1e-26 )
+        {
+            std::cout << "Acceleration is not measured through the nyquist rollover" << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // Streamed in uneven chunks.
+        PhasePurityAnalyzer chunkedPhase{ accel };
+        MagPurityAnalyzer chunkedMag{};
+        for ( size_t n0 = 0, chunk = 1; NUM_SAMPLES > n0; n0 += chunk, chunk = chunk * 3 + 1 )
+        {
+            const auto count = std::min( chunk, NUM_SAMPLES - n0 );
+            chunkedPhase.addSamples( samples.data() + n0, count );
+            chunkedMag.addSamples( samples.data() + n0, count );
+        }
+        if ( !sameStatistics( chunkedPhase.getStatistics(), wholePhase.getStatistics(), 1e-9 )
+          || !sameStatistics( chunkedMag.getStatistics(), wholeMag.getStatistics(), 1e-9 ) )
+        {
+            std::cout << "Chunked analysis disagrees with whole analysis" << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        // Disjoint ranges, each after the first beginning with two samples of history, merged.
+        constexpr size_t NUM_RANGES = 7;
+        PhasePurityAnalyzer mergedPhase{ accel };
+        MagPurityAnalyzer mergedMag{};
+        for ( size_t r = 0; NUM_RANGES != r; ++r )
+        {
+            const auto begin = r * NUM_SAMPLES / NUM_RANGES;
+            const auto end = ( r + 1 ) * NUM_SAMPLES / NUM_RANGES;
+            const auto history = r ? size_t( 2 ) : size_t( 0 );
+            PhasePurityAnalyzer rangePhase{ accel };
+            MagPurityAnalyzer rangeMag{};
+            rangePhase.addSamples( samples.data() + begin - history, end - begin + history );
+            rangeMag.addSamples( samples.data() + begin, end - begin );
+            mergedPhase.merge( rangePhase );
+            mergedMag.merge( rangeMag );
+        }
+        if ( !sameStatistics( mergedPhase.getStatistics(), wholePhase.getStatistics(), 1e-9 )
+          || !sameStatistics( mergedMag.getStatistics(), wholeMag.getStatistics(), 1e-9 ) )
+        {
+            std::cout << "Merged analysis disagrees with whole analysis" << std::endl;
+            retCode = 5;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file chirpingPhasorCTest.c
+ * @brief Exercises the C language interface, compiled as C, as a foreign function interface would use it.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorC.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define NUM_GENERATORS 3
+#define NUM_SAMPLES 1000
+#define ROW_STRIDE 1024
+
+static double rowBuffer[ NUM_GENERATORS * ROW_STRIDE * 2 ];
+static double referenceBuffer[ NUM_SAMPLES * 2 ];
+
+int main( void )
+{
+    const double accel[ NUM_GENERATORS ] = { M_PI / 65536, -M_PI / 32768, 0.0 };
+    const double omegaZero[ NUM_GENERATORS ] = { -0.5, 0.75, 0.1 };
+    const double phi[ NUM_GENERATORS ] = { 0.0, 1.0, -2.0 };
+
+    ReiserRT_ChirpingPhasor_Handle handles[ NUM_GENERATORS ] = { NULL, NULL, NULL };
+    ReiserRT_ChirpingPhasor_Handle reference = NULL;
+    int retCode = 0;
+    size_t i, n;
+
+    do
+    {
+        /* Creation and the closed form. */
+        for ( i = 0; NUM_GENERATORS != i; ++i )
+            if ( ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_create( 0.0, 0.0, 0.0, &handles[i] ) ) retCode = 1;
+        if ( ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_create( accel[0], omegaZero[0], phi[0], &reference ) )
+            retCode = 1;
+        if ( retCode ) { printf( "Create failed\n" ); break; }
+
+        ReiserRT_ChirpingPhasor_getSamples( reference, referenceBuffer, NUM_SAMPLES );
+        {
+            double maxErr = 0.0;
+            for ( n = 0; NUM_SAMPLES != n; ++n )
+            {
+                const double theta = phi[0] + omegaZero[0] * (double)n + 0.5 * accel[0] * (double)n * (double)n;
+                const double err = fabs( referenceBuffer[2 * n] - cos( theta ) ) + fabs( referenceBuffer[2 * n + 1] - sin( theta ) );
+                if ( err > maxErr ) maxErr = err;
+            }
+            printf( "Closed Form Max Error: %g\n", maxErr );
+            if ( maxErr > 1e-12 ) { printf( "Samples disagree with the closed form\n" ); retCode = 2; break; }
+        }
+
+        /* Batch reset and batch generation into rows match individual generation. The batch reset's starting phasors
+           are within an ulp of those of individual resets, so rows may diverge by a little, growing with n squared. */
+        if ( ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_resetMany( handles, accel, omegaZero, phi, NUM_GENERATORS )
+          || ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_getSamplesMany( handles, NUM_GENERATORS, rowBuffer,
+                                                                                   NUM_SAMPLES, ROW_STRIDE ) )
+        {
+            printf( "Batch operations failed\n" );
+            retCode = 3;
+            break;
+        }
+        for ( i = 0; NUM_GENERATORS != i && !retCode; ++i )
+        {
+            ReiserRT_ChirpingPhasor_reset( reference, accel[i], omegaZero[i], phi[i] );
+            ReiserRT_ChirpingPhasor_getSamples( reference, referenceBuffer, NUM_SAMPLES );
+            for ( n = 0; NUM_SAMPLES != n; ++n )
+            {
+                const double * pRow = rowBuffer + 2 * i * ROW_STRIDE;
+                const double bound = ( 1.0 + (double)n + (double)n * (double)n / 2.0 ) * 1.6e-16;
+                if ( fabs( referenceBuffer[2 * n] - pRow[2 * n] ) > bound ||
+                     fabs( referenceBuffer[2 * n + 1] - pRow[2 * n + 1] ) > bound ) break;
+            }
+            if ( NUM_SAMPLES != n )
+            {
+                printf( "Row %u disagrees with individual generation\n", (unsigned)i );
+                retCode = 4;
+            }
+        }
+        if ( retCode ) break;
+
+        /* Chunked generation matches contiguous generation and the sample count advances. */
+        {
+            double * chunks[3];
+            const size_t chunkSizes[3] = { 100, 0, NUM_SAMPLES - 100 };
+            uint64_t count = 0;
+            chunks[0] = rowBuffer;
+            chunks[1] = NULL;
+            chunks[2] = rowBuffer + 2 * 100;
+            ReiserRT_ChirpingPhasor_reset( reference, accel[1], omegaZero[1], phi[1] );
+            if ( ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_getSamplesChunked( reference, chunks, chunkSizes, 3 )
+              || memcmp( rowBuffer, rowBuffer + 2 * ROW_STRIDE, sizeof( referenceBuffer ) )
+              || ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_getSampleCount( reference, &count )
+              || NUM_SAMPLES != count )
+            {
+                printf( "Chunked generation disagrees with contiguous generation\n" );
+                retCode = 5;
+                break;
+            }
+        }
+
+        /* Save, generate, restore and regenerate, into an unaligned state buffer. */
+        {
+            const size_t stateSize = ReiserRT_ChirpingPhasor_stateSize();
+            unsigned char * pStateBuffer = (unsigned char *)malloc( stateSize + 1 );
+            ReiserRT_ChirpingPhasor_modifyAccel( reference, M_PI / 4096 );
+            if ( ReiserRT_ChirpingPhasor_BufferTooSmall != ReiserRT_ChirpingPhasor_saveState( reference, pStateBuffer + 1, stateSize - 1 )
+              || ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_saveState( reference, pStateBuffer + 1, stateSize ) )
+                retCode = 6;
+            ReiserRT_ChirpingPhasor_getSamples( reference, rowBuffer, NUM_SAMPLES );
+            if ( ReiserRT_ChirpingPhasor_Ok != ReiserRT_ChirpingPhasor_restoreState( handles[0], pStateBuffer + 1, stateSize ) )
+                retCode = 6;
+            ReiserRT_ChirpingPhasor_getSamples( handles[0], referenceBuffer, NUM_SAMPLES );
+            if ( memcmp( rowBuffer, referenceBuffer, sizeof( referenceBuffer ) ) ) retCode = 6;
+            free( pStateBuffer );
+            if ( retCode ) { printf( "Save and restore failed\n" ); break; }
+        }
+
+        /* Errors are reported as status codes. */
+        ReiserRT_ChirpingPhasor_destroy( handles[1] );
+        handles[1] = NULL;
+        if ( ReiserRT_ChirpingPhasor_NullArgument != ReiserRT_ChirpingPhasor_getSamples( NULL, referenceBuffer, 1 )
+          || ReiserRT_ChirpingPhasor_NullArgument != ReiserRT_ChirpingPhasor_getSamplesMany( handles, NUM_GENERATORS, rowBuffer, 1, 1 )
+          || ReiserRT_ChirpingPhasor_InvalidArgument != ReiserRT_ChirpingPhasor_getSamplesMany( handles, 1, rowBuffer, 2, 1 )
+          || ReiserRT_ChirpingPhasor_NullArgument != ReiserRT_ChirpingPhasor_create( 0.0, 0.0, 0.0, NULL )
+          || 0 != strcmp( "Ok", ReiserRT_ChirpingPhasor_statusString( ReiserRT_ChirpingPhasor_Ok ) ) )
+        {
+            printf( "Unexpected status codes\n" );
+            retCode = 7;
+            break;
+        }
+    } while ( 0 );
+
+    for ( i = 0; NUM_GENERATORS != i; ++i )
+        ReiserRT_ChirpingPhasor_destroy( handles[i] );
+    ReiserRT_ChirpingPhasor_destroy( reference );
+
+    exit( retCode );
+    return retCode;
+}
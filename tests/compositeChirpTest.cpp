@@ -0,0 +1,124 @@
+/**
+ * @file compositeChirpTest.cpp
+ * @brief Verifies the Composite Chirp Generator against the sum of individual ChirpingPhasor Generators.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "CompositeChirpGenerator.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // The sum of individual generators, accumulated in the same order as the composite.
+    // Differences should only arise from floating point contraction choices of the compiler.
+    void referenceSum( std::vector< ChirpingPhasorToneGenerator > & generators,
+                       const std::vector< FlyingPhasorElementType > & amplitudes,
+                       FlyingPhasorElementBufferTypePtr pOut, size_t numSamples )
+    {
+        std::vector< FlyingPhasorElementType > samples( numSamples );
+        std::fill( pOut, pOut + numSamples, FlyingPhasorElementType{} );
+        for ( size_t k = 0; generators.size() != k; ++k )
+        {
+            generators[k].getSamples( samples.data(), numSamples );
+            for ( size_t n = 0; numSamples != n; ++n )
+                pOut[n] += amplitudes[k] * samples[n];
+        }
+    }
+}
+
+int main()
+{
+    constexpr size_t NUM_COMPONENTS = 7;
+    constexpr size_t CALL_SIZES[] = { 1, 1023, 1024, 1025, 5000 };
+
+    int retCode = 0;
+
+    std::vector< CompositeChirpGenerator::Component > components;
+    std::vector< ChirpingPhasorToneGenerator > generators;
+    std::vector< FlyingPhasorElementType > amplitudes;
+    for ( size_t k = 0; NUM_COMPONENTS != k; ++k )
+    {
+        const auto accel = M_PI / double( 2048 << ( k % 4 ) ) * ( k & 0x1 ? -1.0 : 1.0 );
+        const auto omegaZero = -2.0 + 0.6 * double( k );
+        const auto phi = 0.3 * double( k );
+        const auto amplitude = std::polar( 1.0 / double( k + 1 ), -0.5 * double( k ) );
+        components.push_back( { accel, omegaZero, phi, amplitude } );
+        generators.emplace_back( accel, omegaZero, phi );
+        amplitudes.push_back( amplitude );
+    }
+
+    CompositeChirpGenerator composite{ components.data(), components.size() };
+    do
+    {
+        // Straddle block boundaries, changing an amplitude midway.
+        size_t total = 0;
+        for ( const auto callSize : CALL_SIZES )
+        {
+            if ( 1025 == callSize )
+            {
+                composite.setAmplitude( 3, { 0.0, 2.0 } );
+                amplitudes[3] = { 0.0, 2.0 };
+            }
+            std::vector< FlyingPhasorElementType > expected( callSize );
+            std::vector< FlyingPhasorElementType > actual( callSize );
+            referenceSum( generators, amplitudes, expected.data(), callSize );
+            composite.getSamples( actual.data(), callSize );
+            total += callSize;
+            if ( maxError( expected, actual ) > 1e-12 )
+            {
+                std::cout << "Composite differs from the sum of individual generators" << std::endl;
+                retCode = 1;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        if ( total != composite.getSampleCount() || NUM_COMPONENTS != composite.getNumComponents() )
+        {
+            std::cout << "Sample Count should be " << total << " and is " << composite.getSampleCount() << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Reset restarts from sample zero with original amplitudes.
+        composite.reset();
+        for ( size_t k = 0; NUM_COMPONENTS != k; ++k )
+        {
+            generators[k].reset( components[k].accel, components[k].omegaZero, components[k].phi );
+            amplitudes[k] = components[k].amplitude;
+        }
+        std::vector< FlyingPhasorElementType > expected( 3000 );
+        std::vector< FlyingPhasorElementType > actual( 3000 );
+        referenceSum( generators, amplitudes, expected.data(), expected.size() );
+        composite.getSamples( actual.data(), actual.size() );
+        if ( maxError( expected, actual ) > 1e-12 )
+        {
+            std::cout << "Composite differs after reset" << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        try
+        {
+            composite.setAmplitude( NUM_COMPONENTS, { 1.0, 0.0 } );
+            std::cout << "Setting the amplitude of a non-existent component should have thrown" << std::endl;
+            retCode = 4;
+            break;
+        }
+        catch ( const std::out_of_range & ) {}
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file constexprChirpTableTest.cpp
+ * @brief Verifies that chirp tables generated at compile time agree with the ChirpingPhasorToneGenerator.
+ *
+ * This test is compiled to the C++14 standard, as is required of clients of ConstexprChirpTable.h.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ConstexprChirpTable.h"
+#include "ChirpingPhasorToneGenerator.h"
+#include "MiscTestUtilities.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t NUM_SAMPLES = 2048;
+    constexpr double ACCEL = 3.0 * M_PI / NUM_SAMPLES / NUM_SAMPLES;
+    constexpr double OMEGA_ZERO = -0.75 * M_PI;
+    constexpr double PHI = 1.25;
+
+    // These are constant initialized. Were they not computable at compile time, this would not compile.
+    constexpr auto doubleTable = makeChirpTable< NUM_SAMPLES, double >( ACCEL, OMEGA_ZERO, PHI );
+    constexpr auto floatTable = makeChirpTable< NUM_SAMPLES >( ACCEL, OMEGA_ZERO, PHI );
+    constexpr auto int16Table = makeChirpTableInt16< NUM_SAMPLES >( ACCEL, OMEGA_ZERO, PHI, 30000.0 );
+
+    static_assert( int16Table.size() == 2 * NUM_SAMPLES, "Interleaved table has the wrong size" );
+    static_assert( doubleTable[0].real() > 0.315 && doubleTable[0].real() < 0.316, "First sample is not cos( phi )" );
+}
+
+int main()
+{
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        // Runtime reference.
+        ChirpingPhasorToneGenerator chirpingPhasorToneGenerator{ ACCEL, OMEGA_ZERO, PHI };
+        std::vector< FlyingPhasorElementType > runtime( NUM_SAMPLES );
+        chirpingPhasorToneGenerator.getSamples( runtime.data(), runtime.size() );
+
+        // Agreement is not bit for bit in general. Each sample must be within the documented bound, and for these
+        // parameters the seeds are expected to agree closely enough that the whole table is within 1e-12.
+        double maxErr = 0.0;
+        for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+        {
+            const auto err = std::abs( doubleTable[n] - runtime[n] );
+            const auto bound = seedDivergenceBound( n );
+            if ( err > bound )
+            {
+                std::cout << "Double table sample " << n << " error " << err << " exceeds the documented bound "
+                          << bound << std::endl;
+                retCode = 5;
+                break;
+            }
+            maxErr = std::max( maxErr, err );
+        }
+        if ( retCode ) break;
+        std::cout << "Double Table Max Error: " << maxErr << std::endl;
+        if ( maxErr > 1e-12 )
+        {
+            std::cout << "Double table disagrees with the runtime generator" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // The float table is the double table, rounded.
+        bool floatMatches = true;
+        for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+            floatMatches = floatMatches && floatTable[n] == std::complex< float >( doubleTable[n] );
+        if ( !floatMatches )
+        {
+            std::cout << "Float table is not the rounded double table" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // The 16 bit table is interleaved, scaled and rounded.
+        bool int16Matches = true;
+        for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+        {
+            int16Matches = int16Matches
+                && int16Table[2 * n] == static_cast< int16_t >( std::lround( 30000.0 * doubleTable[n].real() ) )
+                && int16Table[2 * n + 1] == static_cast< int16_t >( std::lround( 30000.0 * doubleTable[n].imag() ) );
+        }
+        if ( !int16Matches )
+        {
+            std::cout << "16 bit table is not the scaled and rounded double table" << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // A bad scale throws when evaluated at runtime.
+        bool threw = false;
+        try
+        {
+            volatile double badScale = 40000.0;
+            makeChirpTableInt16< 4 >( ACCEL, OMEGA_ZERO, PHI, badScale );
+        }
+        catch ( const std::invalid_argument & )
+        {
+            threw = true;
+        }
+        if ( !threw )
+        {
+            std::cout << "Expected invalid_argument for a bad scale" << std::endl;
+            retCode = 4;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
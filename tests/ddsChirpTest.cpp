@@ -0,0 +1,149 @@
+/**
+ * @file ddsChirpTest.cpp
+ * @brief Verifies the DDS Chirp Generator accumulators, determinism and accuracy.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "DdsChirpGenerator.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Returns the maximum phase and magnitude errors of a DDS relative to the ChirpingPhasorToneGenerator.
+    std::pair< double, double > compare( DdsChirpGenerator & dds, size_t numSamples,
+                                         double accel, double omegaZero, double phi )
+    {
+        std::unique_ptr< FlyingPhasorElementType[] > pDdsBuf{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< FlyingPhasorElementType[] > pRefBuf{ new FlyingPhasorElementType[ numSamples ] };
+
+        dds.reset( accel, omegaZero, phi );
+        dds.getSamples( pDdsBuf.get(), numSamples );
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        chirpGen.getSamples( pRefBuf.get(), numSamples );
+
+        double maxPhaseErr = 0.0;
+        double maxMagErr = 0.0;
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            const auto phaseErr = std::abs( std::arg( pDdsBuf[n] * std::conj( pRefBuf[n] ) ) );
+            if ( phaseErr > maxPhaseErr ) maxPhaseErr = phaseErr;
+            const auto magErr = std::abs( std::abs( pDdsBuf[n] ) - 1.0 );
+            if ( magErr > maxMagErr ) maxMagErr = magErr;
+        }
+        return { maxPhaseErr, maxMagErr };
+    }
+}
+
+int main()
+{
+    constexpr size_t NUM_SAMPLES = 8192;
+    constexpr auto accel = M_PI / NUM_SAMPLES;
+    constexpr auto omegaZero = -0.3;
+    constexpr auto phi = 1.25;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        // The accumulators must satisfy the closed form, P(n) = P0 + F0 * n + A * n * (n - 1) / 2, modulo 2^64.
+        DdsChirpGenerator dds{};
+        const auto words = DdsChirpGenerator::tuningWordsFor( accel, omegaZero, phi );
+        dds.reset( words );
+        std::unique_ptr< DdsChirpGenerator::Sample[] > pSampleBuf{ new DdsChirpGenerator::Sample[ NUM_SAMPLES ] };
+        dds.getSamples( pSampleBuf.get(), 1000 );
+        const uint64_t n = 1000;
+        const uint64_t expectedPhase = words.phase + words.frequency * n + words.frequencyStep * ( n * ( n - 1 ) / 2 );
+        if ( expectedPhase != dds.getPhaseAccumulator() || 1000 != dds.getSampleCount() )
+        {
+            std::cout << "Phase Accumulator should be " << expectedPhase << " and is "
+                      << dds.getPhaseAccumulator() << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // A quarter turn of phase produces exactly (0, fullScale).
+        dds.reset( DdsChirpGenerator::TuningWords{ uint64_t( 1 ) << 62, 0, 0 } );
+        dds.getSamples( pSampleBuf.get(), 1 );
+        if ( 0 != pSampleBuf[0].i || dds.getFullScale() != pSampleBuf[0].q )
+        {
+            std::cout << "Quarter Turn Sample should be (0, " << dds.getFullScale() << ") and is ("
+                      << pSampleBuf[0].i << ", " << pSampleBuf[0].q << ")" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Two instances are identical, and block boundaries do not matter.
+        DdsChirpGenerator ddsA{ 10, 16, true };
+        DdsChirpGenerator ddsB{ 10, 16, true };
+        std::unique_ptr< DdsChirpGenerator::Sample[] > pOtherBuf{ new DdsChirpGenerator::Sample[ NUM_SAMPLES ] };
+        ddsA.reset( accel, omegaZero, phi );
+        ddsB.reset( accel, omegaZero, phi );
+        ddsA.getSamples( pSampleBuf.get(), NUM_SAMPLES );
+        for ( size_t i = 0; i < NUM_SAMPLES; i += 13 )
+            ddsB.getSamples( pOtherBuf.get() + i, std::min< size_t >( 13, NUM_SAMPLES - i ) );
+        for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        {
+            if ( pSampleBuf[i].i != pOtherBuf[i].i || pSampleBuf[i].q != pOtherBuf[i].q )
+            {
+                std::cout << "DDS instances differ at index " << i << std::endl;
+                retCode = 3;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // A user supplied table reproduces the internal one.
+        std::unique_ptr< int32_t[] > pTable{ new int32_t[ 1024 ] };
+        for ( size_t k = 0; 1024 != k; ++k )
+            pTable[k] = int32_t( std::lround( std::cos( 2.0 * M_PI * double( k ) / 1024.0 ) * 32767 ) );
+        DdsChirpGenerator ddsC{ pTable.get(), 10, 32767, true };
+        ddsC.reset( accel, omegaZero, phi );
+        ddsC.getSamples( pOtherBuf.get(), NUM_SAMPLES );
+        for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        {
+            if ( pSampleBuf[i].i != pOtherBuf[i].i || pSampleBuf[i].q != pOtherBuf[i].q )
+            {
+                std::cout << "User Table DDS differs at index " << i << std::endl;
+                retCode = 4;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Accuracy against the floating point generator. Without interpolation, phase error is bounded by
+        // one table step as the phase is truncated. With interpolation, the error is dominated by
+        // the amplitude quantization.
+        DdsChirpGenerator ddsTrunc{ 12, 16, false };
+        auto errs = compare( ddsTrunc, NUM_SAMPLES, accel, omegaZero, phi );
+        std::cout << "Non-Interpolated Max Phase Error: " << errs.first << ", Max Mag Error: " << errs.second << std::endl;
+        if ( errs.first > 2.0 * M_PI / 4096 * 1.01 || errs.second > 1e-3 )
+        {
+            std::cout << "Non-Interpolated DDS Error out of Tolerance!" << std::endl;
+            retCode = 5;
+            break;
+        }
+        DdsChirpGenerator ddsInterp{ 12, 24, true };
+        errs = compare( ddsInterp, NUM_SAMPLES, accel, omegaZero, phi );
+        std::cout << "Interpolated Max Phase Error: " << errs.first << ", Max Mag Error: " << errs.second << std::endl;
+        if ( errs.first > 1e-6 || errs.second > 1e-6 )
+        {
+            std::cout << "Interpolated DDS Error out of Tolerance!" << std::endl;
+            retCode = 6;
+            break;
+        }
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
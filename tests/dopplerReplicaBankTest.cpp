@@ -0,0 +1,85 @@
+/**
+ * @file dopplerReplicaBankTest.cpp
+ * @brief Verifies the Doppler Replica Bank against individual ChirpingPhasor Generators.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "DopplerReplicaBank.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t NUM_REPLICAS = 9;
+    constexpr size_t CALL_SIZES[] = { 1001, 256, 3, 514 };
+    constexpr auto accel = M_PI / 4096;
+    constexpr auto omegaZero = -0.1;
+    constexpr auto phi = 0.3;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    std::vector< double > offsets( NUM_REPLICAS );
+    for ( size_t m = 0; NUM_REPLICAS != m; ++m )
+        offsets[m] = 0.01 * ( double( m ) - double( NUM_REPLICAS / 2 ) );
+
+    // A reference generator per replica with its omegaZero offset.
+    std::vector< ChirpingPhasorToneGenerator > references;
+    for ( size_t m = 0; NUM_REPLICAS != m; ++m )
+        references.emplace_back( accel, omegaZero + offsets[m], phi );
+
+    DopplerReplicaBank bank{ accel, omegaZero, phi, offsets.data(), NUM_REPLICAS };
+    double maxErr = 0.0;
+    size_t total = 0;
+    for ( const auto callSize : CALL_SIZES )
+    {
+        std::vector< FlyingPhasorElementType > actual( NUM_REPLICAS * callSize );
+        bank.getSamples( actual.data(), callSize );
+        total += callSize;
+        for ( size_t m = 0; NUM_REPLICAS != m; ++m )
+        {
+            for ( size_t n = 0; callSize != n; ++n )
+                maxErr = std::max( maxErr, std::abs( actual[ m * callSize + n ] - references[m].getSample() ) );
+        }
+    }
+
+    std::cout << "Max Error: " << maxErr << std::endl;
+    do
+    {
+        if ( total != bank.getSampleCount() || NUM_REPLICAS != bank.getNumReplicas() )
+        {
+            std::cout << "Sample Count should be " << total << " and is " << bank.getSampleCount() << std::endl;
+            retCode = 1;
+            break;
+        }
+        if ( maxErr > 1e-11 )
+        {
+            std::cout << "Doppler Replica Error out of Tolerance! Should be less than: " << 1e-11 << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // A reset starts over.
+        bank.reset();
+        std::vector< FlyingPhasorElementType > actual( NUM_REPLICAS );
+        bank.getSamples( actual.data(), 1 );
+        if ( std::abs( actual[0] - std::polar( 1.0, phi ) ) > 1e-15 )
+        {
+            std::cout << "First sample after reset should be " << std::polar( 1.0, phi ) << " and is "
+                      << actual[0] << std::endl;
+            retCode = 3;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
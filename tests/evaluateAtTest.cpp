@@ -0,0 +1,150 @@
+/**
+ * @file evaluateAtTest.cpp
+ * @brief Verifies evaluation at irregular, and fractional, sample offsets against the closed form chirp.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Sorted offsets with gaps of zero, of either side of the stepping limit, and far beyond it.
+    std::vector< uint64_t > makeOffsets( size_t numOffsets, uint64_t firstOffset )
+    {
+        constexpr uint64_t gaps[] = { 0, 1, 2, 5, ChirpingPhasorToneGenerator::maxSteppedGap,
+                                      ChirpingPhasorToneGenerator::maxSteppedGap + 1, 100, 5000 };
+        std::vector< uint64_t > offsets( numOffsets );
+        uint64_t offset = firstOffset;
+        uint32_t lcg = 12345;
+        for ( auto & o : offsets )
+        {
+            o = offset;
+            offset += gaps[ ( lcgNext( lcg ) >> 16 ) % ( sizeof( gaps ) / sizeof( gaps[0] ) ) ];
+        }
+        return offsets;
+    }
+}
+
+int main()
+{
+    constexpr size_t NUM_OFFSETS = 3000;
+    constexpr size_t NUM_ADVANCE = 1234;
+    constexpr double TOLERANCE = 1e-10;
+    constexpr auto accel = M_PI / 1048576;
+    constexpr auto omegaZero = -M_PI / 3;
+    constexpr auto phi = 0.75;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+
+    do
+    {
+        // Offsets relative to a generator part way through its series, beginning with offset zero.
+        ChirpingPhasorToneGenerator generator{ accel, omegaZero, phi };
+        std::vector< FlyingPhasorElementType > samples( NUM_ADVANCE );
+        generator.getSamples( samples.data(), samples.size() );
+        const auto nextSample = generator.peekNextSample();
+
+        const auto offsets = makeOffsets( NUM_OFFSETS, 0 );
+        samples.resize( NUM_OFFSETS );
+        generator.evaluateAt( offsets.data(), samples.data(), samples.size() );
+
+        double maxErr = 0.0;
+        for ( size_t i = 0; NUM_OFFSETS != i; ++i )
+        {
+            const auto expected = exactSample( accel, omegaZero, phi, (long double)( NUM_ADVANCE + offsets[i] ) );
+            maxErr = std::max( maxErr, std::abs( samples[i] - expected ) );
+        }
+        std::cout << "Offsets (up to " << offsets.back() << ") max error: " << maxErr << std::endl;
+        if ( TOLERANCE < maxErr )
+        {
+            std::cout << "Evaluation at offsets exceeds tolerance." << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // The machine is unaffected.
+        if ( generator.getSampleCount() != NUM_ADVANCE || generator.peekNextSample() != nextSample )
+        {
+            std::cout << "Evaluation at offsets disturbed the machine." << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Fractional times, jittered about integer offsets, against the closed form.
+        std::vector< double > times( NUM_OFFSETS );
+        for ( size_t i = 0; NUM_OFFSETS != i; ++i )
+            times[i] = double( offsets[i] ) + 0.45 * std::sin( double( i ) );
+        generator.evaluateAt( times.data(), samples.data(), samples.size() );
+
+        maxErr = 0.0;
+        for ( size_t i = 0; NUM_OFFSETS != i; ++i )
+        {
+            const auto expected = exactSample( accel, omegaZero, phi, (long double)NUM_ADVANCE + times[i] );
+            maxErr = std::max( maxErr, std::abs( samples[i] - expected ) );
+        }
+        std::cout << "Fractional times max error: " << maxErr << std::endl;
+        if ( TOLERANCE < maxErr )
+        {
+            std::cout << "Evaluation at fractional times exceeds tolerance." << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // After an acceleration modification, the quadratic phase carries on from the phase
+        // and angular velocity at the point of modification.
+        constexpr auto newAccel = -2.0 * accel;
+        generator.modifyAccel( newAccel );
+        const long double t0 = NUM_ADVANCE;
+        const long double thetaZero = phi + omegaZero * t0 + 0.5L * accel * t0 * t0;
+        const long double omegaAtModify = omegaZero + accel * t0;
+
+        samples.resize( NUM_OFFSETS );
+        generator.evaluateAt( offsets.data(), samples.data(), samples.size() );
+
+        maxErr = 0.0;
+        for ( size_t i = 0; NUM_OFFSETS != i; ++i )
+        {
+            const long double m = offsets[i];
+            const long double theta = thetaZero + omegaAtModify * m + 0.5L * newAccel * m * m;
+            const auto wrapped = std::fmod( theta, 2.0L * 3.14159265358979323846264338327950288L );
+            const auto expected = std::polar( 1.0, double( wrapped ) );
+            maxErr = std::max( maxErr, std::abs( samples[i] - expected ) );
+        }
+        std::cout << "After modifyAccel max error: " << maxErr << std::endl;
+        if ( TOLERANCE < maxErr )
+        {
+            std::cout << "Evaluation after modifyAccel exceeds tolerance." << std::endl;
+            retCode = 4;
+            break;
+        }
+
+        // Offsets out of order are rejected.
+        const uint64_t unsorted[] = { 10, 20, 15 };
+        bool threw = false;
+        try { generator.evaluateAt( unsorted, samples.data(), 3 ); }
+        catch ( const std::invalid_argument & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Unsorted offsets were not rejected." << std::endl;
+            retCode = 5;
+            break;
+        }
+    } while ( false );
+
+    exit( retCode );
+    return retCode;
+}
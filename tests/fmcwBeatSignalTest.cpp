@@ -0,0 +1,104 @@
+/**
+ * @file fmcwBeatSignalTest.cpp
+ * @brief Verifies the FMCW Beat Signal Synthesizer against full rate dechirping of a transmit chirp and
+ * its echoes.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "FmcwBeatSignalSynthesizer.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t DECIMATION = 16;
+    constexpr size_t NUM_IF_SAMPLES = 4000;
+    constexpr size_t CALL_SIZES[] = { 1, 1023, 1500, 1476 };
+    constexpr auto accel = M_PI / ( 1 << 22 );
+    constexpr auto omegaZero = -M_PI / 2;
+    constexpr auto phi = 0.7;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    // Targets with fractional delays (some arriving well into the sweep) and Doppler shifts.
+    std::vector< FmcwBeatSignalSynthesizer::Target > targets;
+    for ( size_t i = 0; 12 != i; ++i )
+    {
+        const auto delay = 3.25 + 731.3 * double( i );
+        const auto doppler = 1e-4 * ( double( i % 5 ) - 2.0 );
+        targets.push_back( { delay, doppler, std::polar( 1.0 / double( i + 1 ), 0.4 * double( i ) ) } );
+    }
+
+    // Full rate reference. The transmit chirp comes from a ChirpingPhasorToneGenerator. Echoes are closed form.
+    const auto numFullRate = NUM_IF_SAMPLES * DECIMATION;
+    ChirpingPhasorToneGenerator txGen{ accel, omegaZero, phi };
+    std::vector< FlyingPhasorElementType > tx( numFullRate );
+    txGen.getSamples( tx.data(), numFullRate );
+    std::vector< FlyingPhasorElementType > expected( NUM_IF_SAMPLES );
+    for ( size_t k = 0; NUM_IF_SAMPLES != k; ++k )
+    {
+        const auto n = k * DECIMATION;
+        FlyingPhasorElementType rx{};
+        for ( const auto & target : targets )
+        {
+            if ( double( n ) < target.delay ) continue;
+            const long double t = ( long double )( n ) - target.delay;
+            const long double theta = phi + omegaZero * t + 0.5L * accel * t * t + target.doppler * ( long double )( n );
+            rx += target.amplitude * std::polar( 1.0, double( std::fmod( theta, 2.0L * 3.14159265358979323846264338327950288L ) ) );
+        }
+        expected[k] = rx * std::conj( tx[n] );
+    }
+
+    FmcwBeatSignalSynthesizer synth{ accel, omegaZero, DECIMATION, targets.data(), targets.size() };
+    std::vector< FlyingPhasorElementType > actual( NUM_IF_SAMPLES );
+    do
+    {
+        for ( size_t pass = 0; 2 != pass; ++pass )
+        {
+            size_t pos = 0;
+            for ( const auto callSize : CALL_SIZES )
+            {
+                synth.getSamples( actual.data() + pos, callSize );
+                pos += callSize;
+            }
+
+            double maxErr = 0.0;
+            for ( size_t k = 0; NUM_IF_SAMPLES != k; ++k )
+                maxErr = std::max( maxErr, std::abs( actual[k] - expected[k] ) );
+            std::cout << "Pass " << pass << ", Max Error: " << maxErr << std::endl;
+            if ( maxErr > 1e-9 || NUM_IF_SAMPLES != synth.getSampleCount() )
+            {
+                std::cout << "Beat signal disagrees with full rate dechirp" << std::endl;
+                retCode = 1;
+                break;
+            }
+
+            // Second pass after a reset.
+            synth.reset();
+        }
+        if ( retCode ) break;
+
+        try
+        {
+            FmcwBeatSignalSynthesizer bad{ accel, omegaZero, 0, targets.data(), targets.size() };
+            std::cout << "A decimation of zero should have thrown" << std::endl;
+            retCode = 2;
+            break;
+        }
+        catch ( const std::invalid_argument & ) {}
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file generateTest.cpp
+ * @brief Verifies that the generate (visitor) operation delivers the same series as getSamples.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t NUM_SAMPLES = 10000;
+    constexpr size_t CALL_SIZES[] = { 1, 2, 999, 4096, 4902 };
+    constexpr auto accel = M_PI / 8192;
+    constexpr auto omegaZero = -M_PI / 3;
+    constexpr auto phi = 0.25;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        // Run both with and without resynchronization. Call sizes straddle resync points.
+        for ( const size_t resyncInterval : { size_t( 0 ), size_t( 1000 ) } )
+        {
+            ChirpingPhasorToneGenerator bufferGen{ accel, omegaZero, phi };
+            ChirpingPhasorToneGenerator visitGen{ accel, omegaZero, phi };
+            bufferGen.setResyncInterval( resyncInterval );
+            visitGen.setResyncInterval( resyncInterval );
+
+            std::vector< FlyingPhasorElementType > expected( NUM_SAMPLES );
+            bufferGen.getSamples( expected.data(), NUM_SAMPLES );
+
+            std::vector< FlyingPhasorElementType > actual;
+            actual.reserve( NUM_SAMPLES );
+            for ( const auto callSize : CALL_SIZES )
+                visitGen.generate( callSize, [&actual]( const FlyingPhasorElementType & s ){ actual.push_back( s ); } );
+
+            if ( expected != actual || bufferGen.getSampleCount() != visitGen.getSampleCount() )
+            {
+                std::cout << "Visited samples differ from buffered samples with resync interval "
+                          << resyncInterval << std::endl;
+                retCode = 1;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // A typical reduction, correlation against a reference, never materializing our samples.
+        ChirpingPhasorToneGenerator refGen{ accel, omegaZero, phi };
+        std::vector< FlyingPhasorElementType > reference( NUM_SAMPLES );
+        refGen.getSamples( reference.data(), NUM_SAMPLES );
+
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        const FlyingPhasorElementType * pRef = reference.data();
+        FlyingPhasorElementType correlation{};
+        chirpGen.generate( NUM_SAMPLES, [&]( const FlyingPhasorElementType & s ){ correlation += s * std::conj( *pRef++ ); } );
+        std::cout << "Correlation: " << correlation << std::endl;
+        if ( std::abs( correlation - FlyingPhasorElementType{ double( NUM_SAMPLES ), 0.0 } ) > 1e-9 )
+        {
+            std::cout << "Correlation should be " << NUM_SAMPLES << std::endl;
+            retCode = 2;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file latencyHistogramTest.cpp
+ * @brief Verifies the bucketing, percentiles and merging of the Latency Histogram.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "LatencyHistogram.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    int retCode = 0;
+
+    do
+    {
+        // Every value lies within its bucket, whose width is within 1 / subBucketCount of the value.
+        bool bucketsOk = true;
+        for ( uint64_t v : { uint64_t( 0 ), uint64_t( 31 ), uint64_t( 32 ), uint64_t( 33 ), uint64_t( 1000 ),
+                             uint64_t( 123456789 ), std::numeric_limits< uint64_t >::max() } )
+        {
+            const auto index = LatencyHistogram::bucketIndex( v );
+            const auto highest = LatencyHistogram::bucketHighestValue( index );
+            const auto lowest = index ? LatencyHistogram::bucketHighestValue( index - 1 ) + 1 : 0;
+            bucketsOk = bucketsOk && index < LatencyHistogram::bucketCount && lowest <= v && v <= highest
+                     && double( highest - lowest ) <= double( v ) / LatencyHistogram::subBucketCount;
+        }
+        if ( !bucketsOk )
+        {
+            std::cout << "Bucketing is inconsistent" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Record 1..10000 into a histogram in two halves and merge them.
+        std::unique_ptr< LatencyHistogram > pLower{ new LatencyHistogram{} };
+        std::unique_ptr< LatencyHistogram > pUpper{ new LatencyHistogram{} };
+        for ( uint64_t v = 1; 5000 >= v; ++v ) pLower->record( v );
+        for ( uint64_t v = 5001; 10000 >= v; ++v ) pUpper->record( v );
+        pLower->merge( *pUpper );
+        pLower->report( std::cout, "Merged" );
+
+        auto within = []( uint64_t value, uint64_t expected )
+        {
+            return value >= expected && double( value - expected ) <= double( expected ) / LatencyHistogram::subBucketCount;
+        };
+        if ( 10000 != pLower->getCount() || 1 != pLower->getMin() || 10000 != pLower->getMax()
+          || 5000.5 != pLower->getMean() || !within( pLower->valueAtPercentile( 50.0 ), 5000 )
+          || !within( pLower->valueAtPercentile( 99.0 ), 9900 ) || !within( pLower->valueAtPercentile( 99.9 ), 9990 )
+          || 10000 != pLower->valueAtPercentile( 100.0 ) || 1 != pLower->valueAtPercentile( 0.0 ) )
+        {
+            std::cout << "Statistics are incorrect" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // A single outlier defines the maximum and the tail, not the median.
+        pLower->clear();
+        for ( int i = 0; 999 != i; ++i ) pLower->record( 100 );
+        pLower->record( 1000000 );
+        if ( !within( pLower->valueAtPercentile( 50.0 ), 100 ) || !within( pLower->valueAtPercentile( 99.9 ), 100 )
+          || 1000000 != pLower->valueAtPercentile( 99.95 ) || 1000000 != pLower->getMax() )
+        {
+            std::cout << "Outlier statistics are incorrect" << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // Scoped timing of generation, and no recording with a null histogram.
+        pLower->clear();
+        ChirpingPhasorToneGenerator chirpingPhasorToneGenerator{ 1e-6, 0.1, 0.0 };
+        std::vector< FlyingPhasorElementType > samples( 4096 );
+        for ( int i = 0; 100 != i; ++i )
+        {
+            ScopedLatencyTimer timer{ pLower.get() };
+            chirpingPhasorToneGenerator.getSamples( samples.data(), samples.size() );
+        }
+        {
+            ScopedLatencyTimer timer{ nullptr };
+            chirpingPhasorToneGenerator.getSamples( samples.data(), samples.size() );
+        }
+        pLower->report( std::cout, "getSamples( 4096 )" );
+        if ( 100 != pLower->getCount() || 0 == pLower->getMin() )
+        {
+            std::cout << "Scoped timing is incorrect" << std::endl;
+            retCode = 4;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
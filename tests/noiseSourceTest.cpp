@@ -0,0 +1,122 @@
+/**
+ * @file noiseSourceTest.cpp
+ * @brief Verifies the statistics and reproducibility of the Complex Gaussian Noise Source, and the
+ * fused noisy generation of the ChirpingPhasorToneGenerator.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ComplexGaussianNoiseSource.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t NUM_SAMPLES = 1000000;
+    constexpr size_t CALL_SIZES[] = { 1, 100, 127, 128, 1000, 12345 };
+    constexpr auto snrDb = 6.0;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(6);
+
+    const auto noisePower = ComplexGaussianNoiseSource::noisePowerForSnr( 1.0, snrDb );
+    do
+    {
+        // Statistics. For circularly symmetric complex Gaussian noise of power P, the real and imaginary
+        // parts each have variance P/2, are uncorrelated, and E|n|^4 = 2 P^2.
+        ComplexGaussianNoiseSource noiseSource{ 1234, 0, noisePower };
+        std::vector< FlyingPhasorElementType > noise( NUM_SAMPLES );
+        noiseSource.getSamples( noise.data(), NUM_SAMPLES );
+
+        FlyingPhasorElementType mean{};
+        double realVar = 0.0, imagVar = 0.0, crossVar = 0.0, fourthMoment = 0.0;
+        for ( const auto & n : noise )
+        {
+            mean += n;
+            realVar += n.real() * n.real();
+            imagVar += n.imag() * n.imag();
+            crossVar += n.real() * n.imag();
+            fourthMoment += std::norm( n ) * std::norm( n );
+        }
+        mean /= double( NUM_SAMPLES );
+        realVar /= double( NUM_SAMPLES );
+        imagVar /= double( NUM_SAMPLES );
+        crossVar /= double( NUM_SAMPLES );
+        fourthMoment /= double( NUM_SAMPLES );
+        const auto power = realVar + imagVar;
+        std::cout << "Mean: " << mean << ", Power: " << power << " (" << noisePower << "), Real Var: " << realVar
+                  << ", Imag Var: " << imagVar << ", Cross Var: " << crossVar
+                  << ", Normalized Fourth Moment: " << fourthMoment / ( power * power ) << std::endl;
+        if ( std::abs( mean ) > 0.005 || std::abs( power / noisePower - 1.0 ) > 0.01 ||
+             std::abs( realVar / imagVar - 1.0 ) > 0.01 || std::abs( crossVar ) > 0.005 ||
+             std::abs( fourthMoment / ( power * power ) - 2.0 ) > 0.03 )
+        {
+            std::cout << "Noise statistics are not those of complex white Gaussian noise" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Reproducibility, independent of how the noise is requested.
+        ComplexGaussianNoiseSource sameSource{ 1234, 0, noisePower };
+        std::vector< FlyingPhasorElementType > again( NUM_SAMPLES );
+        size_t pos = 0;
+        for ( size_t i = 0; NUM_SAMPLES != pos; ++i )
+        {
+            auto callSize = CALL_SIZES[ i % ( sizeof( CALL_SIZES ) / sizeof( CALL_SIZES[0] ) ) ];
+            if ( callSize > NUM_SAMPLES - pos ) callSize = NUM_SAMPLES - pos;
+            if ( 1 == callSize ) again[ pos ] = sameSource.getSample();
+            else sameSource.getSamples( again.data() + pos, callSize );
+            pos += callSize;
+        }
+        if ( again != noise )
+        {
+            std::cout << "Noise with the same seed differs" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        // Independent streams should be uncorrelated.
+        ComplexGaussianNoiseSource otherStream{ 1234, 1, noisePower };
+        otherStream.getSamples( again.data(), NUM_SAMPLES );
+        FlyingPhasorElementType crossCorrelation{};
+        for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+            crossCorrelation += noise[n] * std::conj( again[n] );
+        crossCorrelation /= double( NUM_SAMPLES ) * noisePower;
+        std::cout << "Stream Cross Correlation: " << std::abs( crossCorrelation ) << std::endl;
+        if ( std::abs( crossCorrelation ) > 0.005 )
+        {
+            std::cout << "Independent streams are correlated" << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // Fused generation must equal separate generation plus noise.
+        constexpr auto accel = M_PI / 16384;
+        ChirpingPhasorToneGenerator cleanGen{ accel, 0.1, 0.2 };
+        ChirpingPhasorToneGenerator noisyGen{ accel, 0.1, 0.2 };
+        std::vector< FlyingPhasorElementType > expected( 10000 );
+        cleanGen.getSamples( expected.data(), expected.size() );
+        ComplexGaussianNoiseSource separateSource{ 99, 7, noisePower };
+        separateSource.addSamples( expected.data(), expected.size() );
+        std::vector< FlyingPhasorElementType > actual( 10000 );
+        ComplexGaussianNoiseSource fusedSource{ 99, 7, noisePower };
+        noisyGen.getSamplesWithNoise( actual.data(), 3333, fusedSource );
+        noisyGen.getSamplesWithNoise( actual.data() + 3333, 10000 - 3333, fusedSource );
+        if ( expected != actual )
+        {
+            std::cout << "Fused noisy generation differs from separate generation" << std::endl;
+            retCode = 4;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
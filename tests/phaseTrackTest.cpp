@@ -0,0 +1,104 @@
+/**
+ * @file phaseTrackTest.cpp
+ * @brief Verifies the angular velocity and unwrapped phase tracks against the closed form chirp.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t NUM_SAMPLES = 200000;
+    constexpr size_t ACCEL_CHANGE = 120000;
+    constexpr auto accel = M_PI / 16384;
+    constexpr auto newAccel = -M_PI / 4096;
+    constexpr auto omegaZero = -M_PI / 2;
+    constexpr auto phi = 0.3;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    // Closed form reference in long double, piecewise across the acceleration change. Phase errors are
+    // judged relative to the magnitude of the largest term of the phase, the scale of its rounding.
+    std::vector< long double > omegaRef( NUM_SAMPLES ), thetaRef( NUM_SAMPLES ), thetaScale( NUM_SAMPLES );
+    for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+    {
+        if ( n < ACCEL_CHANGE )
+        {
+            const long double t = n;
+            omegaRef[n] = omegaZero + accel * t;
+            thetaRef[n] = phi + omegaZero * t + 0.5L * accel * t * t;
+            thetaScale[n] = 1.0L + std::abs( omegaZero * t ) + std::abs( 0.5L * accel * t * t );
+        }
+        else
+        {
+            const long double t0 = ACCEL_CHANGE;
+            const long double t = n - ACCEL_CHANGE;
+            const long double omega0 = omegaZero + accel * t0;
+            const long double theta0 = phi + omegaZero * t0 + 0.5L * accel * t0 * t0;
+            omegaRef[n] = omega0 + newAccel * t;
+            thetaRef[n] = theta0 + omega0 * t + 0.5L * newAccel * t * t;
+            thetaScale[n] = 1.0L + std::abs( theta0 ) + std::abs( omega0 * t ) + std::abs( 0.5L * newAccel * t * t );
+        }
+    }
+
+    do
+    {
+        for ( const size_t resyncInterval : { size_t( 0 ), size_t( 10000 ) } )
+        {
+            ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+            chirpGen.setResyncInterval( resyncInterval );
+            std::vector< FlyingPhasorElementType > samples( NUM_SAMPLES );
+            std::vector< double > omega( NUM_SAMPLES ), theta( NUM_SAMPLES );
+
+            // Several invocations, one without samples, with an acceleration change.
+            chirpGen.getSamples( samples.data(), 50000, omega.data(), theta.data() );
+            chirpGen.getSamples( nullptr, 30000, omega.data() + 50000, theta.data() + 50000 );
+            chirpGen.getSamples( samples.data() + 80000, ACCEL_CHANGE - 80000, omega.data() + 80000, nullptr );
+            chirpGen.getSamples( nullptr, 0, nullptr, theta.data() + 80000 );
+            chirpGen.modifyAccel( newAccel );
+            chirpGen.getSamples( samples.data() + ACCEL_CHANGE, NUM_SAMPLES - ACCEL_CHANGE,
+                                 omega.data() + ACCEL_CHANGE, theta.data() + ACCEL_CHANGE );
+
+            // The theta gap left above, samples 80000 through ACCEL_CHANGE, is filled from a second run.
+            ChirpingPhasorToneGenerator gapGen{ accel, omegaZero, phi };
+            gapGen.getSamples( nullptr, 80000, nullptr, nullptr );
+            gapGen.getSamples( nullptr, ACCEL_CHANGE - 80000, nullptr, theta.data() + 80000 );
+
+            double maxOmegaErr = 0.0, maxThetaRelErr = 0.0, maxSampleErr = 0.0;
+            for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+            {
+                maxOmegaErr = std::max( maxOmegaErr, double( std::abs( omega[n] - omegaRef[n] ) ) );
+                maxThetaRelErr = std::max( maxThetaRelErr,
+                                           double( std::abs( theta[n] - thetaRef[n] ) / thetaScale[n] ) );
+
+                // The unwrapped phase agrees with the samples delivered (where delivered).
+                if ( n < 50000 || n >= 80000 )
+                    maxSampleErr = std::max( maxSampleErr, std::abs( samples[n] - std::polar( 1.0, theta[n] ) ) );
+            }
+            std::cout << "Resync Interval " << resyncInterval << ", Omega Max Error: " << maxOmegaErr
+                      << ", Theta Max Relative Error: " << maxThetaRelErr
+                      << ", Sample Max Error: " << maxSampleErr << std::endl;
+            if ( maxOmegaErr > 1e-14 || maxThetaRelErr > 1e-15 || maxSampleErr > 1e-8 ||
+                 NUM_SAMPLES != chirpGen.getSampleCount() )
+            {
+                std::cout << "Tracks disagree with the closed form chirp" << std::endl;
+                retCode = 1;
+                break;
+            }
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
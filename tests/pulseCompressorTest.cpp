@@ -0,0 +1,150 @@
+/**
+ * @file pulseCompressorTest.cpp
+ * @brief Verifies the Pulse Compressor against direct time domain correlation.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "PulseCompressor.h"
+#include "ChirpingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Received data of two echoes of the reference, at the given delays, over a deterministic pseudo random floor.
+    std::vector< FlyingPhasorElementType > makeInput( const std::vector< FlyingPhasorElementType > & reference,
+                                                      size_t length, size_t delay1, size_t delay2 )
+    {
+        std::vector< FlyingPhasorElementType > input( length );
+        uint32_t lcg = 2026;
+        for ( auto & x : input )
+        {
+            const auto re = double( lcgNext( lcg ) >> 8 ) / double( 1 << 24 ) - 0.5;
+            const auto im = double( lcgNext( lcg ) >> 8 ) / double( 1 << 24 ) - 0.5;
+            x = FlyingPhasorElementType{ re, im } * 0.1;
+        }
+        for ( size_t k = 0; reference.size() != k; ++k )
+        {
+            if ( delay1 + k < length ) input[ delay1 + k ] += reference[k];
+            if ( delay2 + k < length ) input[ delay2 + k ] += std::polar( 0.5, 1.0 ) * reference[k];
+        }
+        return input;
+    }
+}
+
+int main()
+{
+    constexpr size_t PULSE_LENGTHS[] = { 1, 100, 257 };
+    constexpr size_t INPUT_LENGTH = 3000;
+    constexpr double TOLERANCE = 1e-12;    // Per sample of the reference.
+    constexpr auto omegaZero = -M_PI / 2;
+    constexpr auto phi = 0.3;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+
+    do
+    {
+        for ( const auto pulseLength : PULSE_LENGTHS )
+        {
+            // A chirp sweeping half the band.
+            const auto accel = M_PI / double( pulseLength );
+            std::vector< FlyingPhasorElementType > reference( pulseLength );
+            ChirpingPhasorToneGenerator generator{ accel, omegaZero, phi };
+            generator.getSamples( reference.data(), pulseLength );
+
+            const size_t delay1 = 211;
+            const size_t delay2 = INPUT_LENGTH - pulseLength / 2;
+            const auto input = makeInput( reference, INPUT_LENGTH, delay1, delay2 );
+            std::vector< FlyingPhasorElementType > expected( input.size() );
+            directCorrelation( reference, input.data(), input.size(), expected.data() );
+
+            // The default FFT size, the smallest permitted and a larger one.
+            size_t minFftSize = 1;
+            while ( minFftSize < pulseLength ) minFftSize <<= 1;
+            for ( const size_t fftSize : { size_t( 0 ), minFftSize, size_t( 4096 ) } )
+            {
+                PulseCompressor compressor{ accel, omegaZero, phi, pulseLength, fftSize };
+                std::vector< FlyingPhasorElementType > output( INPUT_LENGTH );
+                compressor.compress( input.data(), input.size(), output.data() );
+
+                const auto err = maxError( output, expected );
+                std::cout << "Pulse length " << pulseLength << ", FFT size " << compressor.getFftSize()
+                          << ", max error: " << err << std::endl;
+                if ( TOLERANCE * double( pulseLength ) < err )
+                {
+                    std::cout << "Compression differs from direct correlation." << std::endl;
+                    retCode = 1;
+                    break;
+                }
+
+                // The stronger echo compresses to a peak of the pulse length at its delay.
+                size_t peak = 0;
+                for ( size_t n = 1; INPUT_LENGTH != n; ++n )
+                    if ( std::abs( output[n] ) > std::abs( output[ peak ] ) ) peak = n;
+                if ( 1 < pulseLength && delay1 != peak )
+                {
+                    std::cout << "Compressed peak at " << peak << " rather than " << delay1 << std::endl;
+                    retCode = 2;
+                    break;
+                }
+            }
+            if ( retCode ) break;
+
+            // The arbitrary reference constructor with the same reference is identical.
+            PulseCompressor chirpCompressor{ accel, omegaZero, phi, pulseLength };
+            PulseCompressor referenceCompressor{ reference.data(), pulseLength };
+            std::vector< FlyingPhasorElementType > a( INPUT_LENGTH ), b( INPUT_LENGTH );
+            chirpCompressor.compress( input.data(), input.size(), a.data() );
+            referenceCompressor.compress( input.data(), input.size(), b.data() );
+            if ( a != b )
+            {
+                std::cout << "Arbitrary reference compression differs from chirp reference compression." << std::endl;
+                retCode = 3;
+                break;
+            }
+
+            // Pulses compressed in parallel are identical to pulses compressed one at a time.
+            constexpr size_t NUM_PULSES = 5;
+            constexpr size_t GATE_LENGTH = INPUT_LENGTH / NUM_PULSES;
+            std::vector< FlyingPhasorElementType > serial( INPUT_LENGTH ), parallel( INPUT_LENGTH );
+            for ( size_t p = 0; NUM_PULSES != p; ++p )
+                chirpCompressor.compress( input.data() + p * GATE_LENGTH, GATE_LENGTH, serial.data() + p * GATE_LENGTH );
+            chirpCompressor.compressPulses( input.data(), parallel.data(), NUM_PULSES, GATE_LENGTH, 3 );
+            if ( serial != parallel )
+            {
+                std::cout << "Parallel pulse compression differs from serial compression." << std::endl;
+                retCode = 4;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Invalid parameters.
+        const auto rejected = []( size_t pulseLength, size_t fftSize ) {
+            try { PulseCompressor compressor{ 0.0, 0.0, 0.0, pulseLength, fftSize }; }
+            catch ( const std::invalid_argument & ) { return true; }
+            return false;
+        };
+        if ( !rejected( 0, 0 ) || !rejected( 100, 96 ) || !rejected( 100, 64 ) || rejected( 100, 128 ) )
+        {
+            std::cout << "Invalid parameters were not rejected, or valid parameters were." << std::endl;
+            retCode = 5;
+            break;
+        }
+    } while ( false );
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file radarSceneSynthesizerTest.cpp
+ * @brief Verifies the Radar Scene Synthesizer against a closed form reference.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "RadarSceneSynthesizer.h"
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Closed form reference for a single pulse. Phases are accumulated in long double.
+    std::vector< FlyingPhasorElementType > referenceGate( const std::vector< RadarSceneSynthesizer::Target > & targets,
+                                                          double accel, double omegaZero, double phi,
+                                                          size_t pulseLength, size_t gateLength, double pulseTime )
+    {
+        std::vector< FlyingPhasorElementType > gate( gateLength );
+        for ( const auto & target : targets )
+        {
+            if ( target.delay < 0.0 || target.delay >= double( gateLength ) ) continue;
+            const auto begin = size_t( std::floor( target.delay ) );
+            for ( size_t n = begin; n < gateLength && n < begin + pulseLength; ++n )
+            {
+                const long double t = ( long double )( n ) - target.delay;
+                const long double m = ( long double )( n - begin );
+                const long double theta = phi + omegaZero * t + 0.5L * accel * t * t
+                    + target.doppler * ( m + ( long double )( pulseTime ) );
+                gate[n] += target.amplitude * std::polar( 1.0, double( std::fmod( theta, 2.0L * ( long double )( M_PI ) ) ) );
+            }
+        }
+        return gate;
+    }
+}
+
+int main()
+{
+    constexpr size_t PULSE_LENGTH = 1500;
+    constexpr size_t GATE_LENGTH = 5000;
+    constexpr size_t NUM_TARGETS = 40;
+    constexpr size_t NUM_PULSES = 6;
+    constexpr double PRI = 8000.0;
+    constexpr auto accel = M_PI / 8192;
+    constexpr auto omegaZero = -0.2;
+    constexpr auto phi = 0.1;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    // Targets spread across, and beyond, the range gate with fractional delays. Some straddle block boundaries.
+    std::vector< RadarSceneSynthesizer::Target > targets;
+    for ( size_t i = 0; NUM_TARGETS != i; ++i )
+    {
+        const auto delay = -200.0 + 137.37 * double( i );
+        const auto doppler = 0.003 * ( double( i % 7 ) - 3.0 );
+        targets.push_back( { delay, doppler, std::polar( 0.5 + 0.01 * double( i ), 0.2 * double( i ) ) } );
+    }
+
+    RadarSceneSynthesizer synth{ accel, omegaZero, phi, PULSE_LENGTH, GATE_LENGTH };
+
+    do
+    {
+        // Single pulse.
+        std::vector< FlyingPhasorElementType > actual( GATE_LENGTH, FlyingPhasorElementType{ 9.0, 9.0 } );
+        synth.synthesize( targets.data(), targets.size(), actual.data() );
+        auto expected = referenceGate( targets, accel, omegaZero, phi, PULSE_LENGTH, GATE_LENGTH, 0.0 );
+        double maxErr = 0.0;
+        for ( size_t n = 0; GATE_LENGTH != n; ++n )
+            maxErr = std::max( maxErr, std::abs( actual[n] - expected[n] ) );
+        std::cout << "Single Pulse Max Error: " << maxErr << std::endl;
+        if ( maxErr > 1e-10 )
+        {
+            std::cout << "Single Pulse Max Error exceeds 1e-10" << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Multiple pulses, threaded and not. Results must be identical.
+        std::vector< FlyingPhasorElementType > serial( NUM_PULSES * GATE_LENGTH );
+        std::vector< FlyingPhasorElementType > threaded( NUM_PULSES * GATE_LENGTH );
+        synth.synthesizePulses( targets.data(), targets.size(), serial.data(), NUM_PULSES, PRI );
+        synth.synthesizePulses( targets.data(), targets.size(), threaded.data(), NUM_PULSES, PRI, 4 );
+        if ( serial != threaded )
+        {
+            std::cout << "Threaded pulses differ from serial pulses" << std::endl;
+            retCode = 2;
+            break;
+        }
+
+        maxErr = 0.0;
+        for ( size_t p = 0; NUM_PULSES != p; ++p )
+        {
+            expected = referenceGate( targets, accel, omegaZero, phi, PULSE_LENGTH, GATE_LENGTH, double( p ) * PRI );
+            for ( size_t n = 0; GATE_LENGTH != n; ++n )
+                maxErr = std::max( maxErr, std::abs( serial[ p * GATE_LENGTH + n ] - expected[n] ) );
+        }
+        std::cout << "Multiple Pulse Max Error: " << maxErr << std::endl;
+        if ( maxErr > 1e-10 )
+        {
+            std::cout << "Multiple Pulse Max Error exceeds 1e-10" << std::endl;
+            retCode = 3;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
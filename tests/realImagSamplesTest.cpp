@@ -0,0 +1,68 @@
+/**
+ * @file realImagSamplesTest.cpp
+ * @brief Verifies the real and imaginary only getSamples variants against complex getSamples.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t NUM_SAMPLES = 5000;
+    constexpr auto accel = M_PI / 8192;
+    constexpr auto omegaZero = 0.4;
+    constexpr auto phi = -2.5;
+
+    int retCode = 0;
+
+    ChirpingPhasorToneGenerator complexGen{ accel, omegaZero, phi };
+    std::vector< FlyingPhasorElementType > expected( NUM_SAMPLES );
+    complexGen.getSamples( expected.data(), NUM_SAMPLES );
+
+    ChirpingPhasorToneGenerator realGen{ accel, omegaZero, phi };
+    ChirpingPhasorToneGenerator realGen32{ accel, omegaZero, phi };
+    ChirpingPhasorToneGenerator imagGen{ accel, omegaZero, phi };
+    ChirpingPhasorToneGenerator imagGen32{ accel, omegaZero, phi };
+    std::vector< double > real( NUM_SAMPLES ), imag( NUM_SAMPLES );
+    std::vector< float > real32( NUM_SAMPLES ), imag32( NUM_SAMPLES );
+
+    // Split across invocations to verify continuity.
+    realGen.getRealSamples( real.data(), 1234 );
+    realGen.getRealSamples( real.data() + 1234, NUM_SAMPLES - 1234 );
+    realGen32.getRealSamples( real32.data(), NUM_SAMPLES );
+    imagGen.getImagSamples( imag.data(), 77 );
+    imagGen.getImagSamples( imag.data() + 77, NUM_SAMPLES - 77 );
+    imagGen32.getImagSamples( imag32.data(), NUM_SAMPLES );
+
+    do
+    {
+        for ( size_t n = 0; NUM_SAMPLES != n; ++n )
+        {
+            if ( real[n] != expected[n].real() || imag[n] != expected[n].imag() ||
+                 real32[n] != float( expected[n].real() ) || imag32[n] != float( expected[n].imag() ) )
+            {
+                std::cout << "Sample " << n << " differs from the complex series" << std::endl;
+                retCode = 1;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        if ( NUM_SAMPLES != realGen.getSampleCount() || NUM_SAMPLES != imagGen32.getSampleCount() )
+        {
+            std::cout << "Sample Count should be " << NUM_SAMPLES << std::endl;
+            retCode = 2;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file resyncTest.cpp
+ * @brief Verifies the periodic exact resynchronization mode of the ChirpingPhasor Generator.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <iostream>
+#include <memory>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    // A long run with a chirp that rolls over the nyquist rate many times.
+    constexpr size_t NUM_SAMPLES = 1 << 22;
+    constexpr size_t CHUNK_SIZE = 4096;
+    constexpr size_t RESYNC_INTERVAL = 1000;    // Deliberately not a divisor of CHUNK_SIZE.
+    constexpr auto accel = M_PI / 16384;
+    constexpr auto omegaZero = 0.25;
+    constexpr auto phi = -0.5;
+    constexpr long double twoPi = 6.283185307179586476925286766559005768L;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        std::unique_ptr< FlyingPhasorElementType[] > pElementBuf{ new FlyingPhasorElementType[ CHUNK_SIZE ] };
+
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        chirpGen.setResyncInterval( RESYNC_INTERVAL );
+        if ( RESYNC_INTERVAL != chirpGen.getResyncInterval() )
+        {
+            std::cout << "Resync Interval should be " << RESYNC_INTERVAL << " and is "
+                      << chirpGen.getResyncInterval() << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        // Reference phase computed from the closed form in long double precision, reducing each term
+        // individually. Incremental accumulation is not used as its error grows quadratically.
+        double maxPhaseErr = 0.0;
+        double maxMagErr = 0.0;
+        for ( size_t n = 0; NUM_SAMPLES != n; n += CHUNK_SIZE )
+        {
+            chirpGen.getSamples( pElementBuf.get(), CHUNK_SIZE );
+            for ( size_t i = 0; CHUNK_SIZE != i; ++i )
+            {
+                const auto s = static_cast< long double >( n + i );
+                const auto refTheta = std::fmod( phi + std::fmod( omegaZero * s, twoPi )
+                                                 + std::fmod( accel / 2.0L * s * s, twoPi ), twoPi );
+                const auto err = std::abs( std::arg( pElementBuf[i] * std::polar( 1.0, -double( refTheta ) ) ) );
+                if ( err > maxPhaseErr ) maxPhaseErr = err;
+                const auto magErr = std::abs( std::abs( pElementBuf[i] ) - 1.0 );
+                if ( magErr > maxMagErr ) maxMagErr = magErr;
+            }
+        }
+        std::cout << "Max Phase Error: " << maxPhaseErr << ", Max Magnitude Error: " << maxMagErr << std::endl;
+        if ( maxPhaseErr > 1e-9 )
+        {
+            std::cout << "Resync Phase Error out of Tolerance! Should be less than: " << 1e-9 << std::endl;
+            retCode = 2;
+            break;
+        }
+        if ( maxMagErr > 1e-15 )
+        {
+            std::cout << "Resync Magnitude Error out of Tolerance! Should be less than: " << 1e-15 << std::endl;
+            retCode = 3;
+            break;
+        }
+
+        // Single sample retrieval must produce identical results to block retrieval, including resyncs.
+        ChirpingPhasorToneGenerator singleGen{ accel, omegaZero, phi };
+        singleGen.setResyncInterval( RESYNC_INTERVAL );
+        chirpGen.reset( accel, omegaZero, phi );
+        chirpGen.getSamples( pElementBuf.get(), CHUNK_SIZE );
+        for ( size_t i = 0; CHUNK_SIZE != i; ++i )
+        {
+            const auto sample = singleGen.getSample();
+            if ( sample != pElementBuf[i] )
+            {
+                std::cout << "Get Single Sample failed at index " << i << ". Expected " << pElementBuf[i]
+                          << ", obtained " << sample << std::endl;
+                retCode = 4;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Disabling resync must leave the recursion untouched.
+        ChirpingPhasorToneGenerator plainGen{ accel, omegaZero, phi };
+        chirpGen.reset( accel, omegaZero, phi );
+        chirpGen.setResyncInterval( 0 );
+        chirpGen.getSamples( pElementBuf.get(), CHUNK_SIZE );
+        for ( size_t i = 0; CHUNK_SIZE != i; ++i )
+        {
+            const auto sample = plainGen.getSample();
+            if ( sample != pElementBuf[i] )
+            {
+                std::cout << "Disabled Resync differs at index " << i << ". Expected " << sample
+                          << ", obtained " << pElementBuf[i] << std::endl;
+                retCode = 5;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Frequent acceleration modifications must not postpone resyncs. Here, the acceleration is "modified"
+        // every half interval, to its current value, so that the closed form phase remains that of the chirp.
+        chirpGen.reset( accel, omegaZero, phi );
+        chirpGen.setResyncInterval( RESYNC_INTERVAL );
+        maxPhaseErr = 0.0;
+        for ( size_t n = 0; NUM_SAMPLES > n; n += RESYNC_INTERVAL / 2 )
+        {
+            chirpGen.getSamples( pElementBuf.get(), RESYNC_INTERVAL / 2 );
+            chirpGen.modifyAccel( accel );
+            for ( size_t i = 0; RESYNC_INTERVAL / 2 != i; ++i )
+            {
+                const auto s = static_cast< long double >( n + i );
+                const auto refTheta = std::fmod( phi + std::fmod( omegaZero * s, twoPi )
+                                                 + std::fmod( accel / 2.0L * s * s, twoPi ), twoPi );
+                const auto err = std::abs( std::arg( pElementBuf[i] * std::polar( 1.0, -double( refTheta ) ) ) );
+                if ( err > maxPhaseErr ) maxPhaseErr = err;
+            }
+
+            const auto state = chirpGen.saveState();
+            if ( state.sampleCounter - state.lastResyncSample >= RESYNC_INTERVAL )
+            {
+                std::cout << "No resync within an interval of sample " << state.sampleCounter
+                          << ", last resync at " << state.lastResyncSample << std::endl;
+                retCode = 6;
+                break;
+            }
+        }
+        if ( retCode ) break;
+        std::cout << "With modifyAccel every half interval, Max Phase Error: " << maxPhaseErr << std::endl;
+        if ( maxPhaseErr > 1e-9 )
+        {
+            std::cout << "Resync Phase Error with modifyAccel out of Tolerance! Should be less than: "
+                      << 1e-9 << std::endl;
+            retCode = 7;
+            break;
+        }
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
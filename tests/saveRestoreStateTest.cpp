@@ -0,0 +1,92 @@
+/**
+ * @file saveRestoreStateTest.cpp
+ * @brief Verifies that a ChirpingPhasor Generator state snapshot restores bit for bit.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <iostream>
+#include <memory>
+#include <cstring>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t NUM_SAMPLES = 4096;
+    constexpr auto accel = M_PI / 8192;
+    constexpr auto omegaZero = 0.125;
+    constexpr auto phi = 0.75;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        std::unique_ptr< FlyingPhasorElementType[] > pExpectedBuf{ new FlyingPhasorElementType[ NUM_SAMPLES ] };
+        std::unique_ptr< FlyingPhasorElementType[] > pRestoredBuf{ new FlyingPhasorElementType[ NUM_SAMPLES ] };
+
+        // Work a generator into an arbitrary state with an odd sample count, a modified acceleration
+        // and resync enabled so that every attribute is exercised.
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        chirpGen.setResyncInterval( 1000 );
+        chirpGen.getSamples( pExpectedBuf.get(), 777 );
+        chirpGen.modifyAccel( -accel / 3 );
+        chirpGen.getSamples( pExpectedBuf.get(), 333 );
+
+        // Take a snapshot and ship it through raw bytes as if through shared memory.
+        const auto snapshot = chirpGen.saveState();
+        unsigned char shippedBytes[ sizeof( snapshot ) ];
+        std::memcpy( shippedBytes, &snapshot, sizeof( snapshot ) );
+
+        // The original continues on.
+        chirpGen.getSamples( pExpectedBuf.get(), NUM_SAMPLES );
+
+        // A default constructed generator picks up where the snapshot was taken.
+        ChirpingPhasorToneGenerator restoredGen{};
+        ChirpingPhasorToneGenerator::StateSnapshot received;
+        std::memcpy( &received, shippedBytes, sizeof( received ) );
+        restoredGen.restoreState( received );
+
+        if ( 1110 != restoredGen.getSampleCount() || 1000 != restoredGen.getResyncInterval() )
+        {
+            std::cout << "Restored Sample Count or Resync Interval incorrect. Sample Count: "
+                      << restoredGen.getSampleCount() << ", Resync Interval: " << restoredGen.getResyncInterval()
+                      << std::endl;
+            retCode = 1;
+            break;
+        }
+
+        restoredGen.getSamples( pRestoredBuf.get(), NUM_SAMPLES );
+        for ( size_t i = 0; NUM_SAMPLES != i; ++i )
+        {
+            if ( pExpectedBuf[i] != pRestoredBuf[i] )
+            {
+                std::cout << "Restored Sample differs at index " << i << ". Expected " << pExpectedBuf[i]
+                          << ", obtained " << pRestoredBuf[i] << std::endl;
+                retCode = 2;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // Restoring into the original, rewinds it.
+        chirpGen.restoreState( snapshot );
+        chirpGen.getSamples( pRestoredBuf.get(), NUM_SAMPLES );
+        if ( 0 != std::memcmp( pExpectedBuf.get(), pRestoredBuf.get(), NUM_SAMPLES * sizeof( FlyingPhasorElementType ) ) )
+        {
+            std::cout << "Rewound Samples differ from original." << std::endl;
+            retCode = 3;
+            break;
+        }
+
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
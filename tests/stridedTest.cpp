@@ -0,0 +1,91 @@
+/**
+ * @file stridedTest.cpp
+ * @brief Verifies strided generation, and subsequent contiguous generation, against the closed form chirp.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include "MiscTestUtilities.h"
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t STRIDE = 7;
+    constexpr size_t NUM_STRIDED = 3000;
+    constexpr size_t NUM_AFTER = 2000;
+    constexpr auto accel = M_PI / 65536;
+    constexpr auto omegaZero = -M_PI / 2;
+    constexpr auto phi = 0.75;
+
+    int retCode = 0;
+
+    std::cout << std::scientific;
+    std::cout.precision(17);
+
+    do
+    {
+        for ( const size_t resyncInterval : { size_t( 0 ), size_t( 5000 ) } )
+        {
+            // Start striding after some contiguous samples so that we don't start at sample zero.
+            constexpr size_t NUM_BEFORE = 101;
+            ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+            chirpGen.setResyncInterval( resyncInterval );
+            std::vector< FlyingPhasorElementType > actual( NUM_STRIDED + NUM_AFTER );
+            chirpGen.getSamples( actual.data(), NUM_BEFORE );
+            chirpGen.getSamplesStrided( actual.data(), NUM_STRIDED, STRIDE );
+            if ( NUM_BEFORE + NUM_STRIDED * STRIDE != chirpGen.getSampleCount() )
+            {
+                std::cout << "Sample Count should be " << NUM_BEFORE + NUM_STRIDED * STRIDE << " and is "
+                          << chirpGen.getSampleCount() << std::endl;
+                retCode = 1;
+                break;
+            }
+
+            double maxStridedErr = 0.0;
+            for ( size_t k = 0; NUM_STRIDED != k; ++k )
+                maxStridedErr = std::max( maxStridedErr, std::abs( actual[k] -
+                    exactSample( accel, omegaZero, phi, NUM_BEFORE + k * STRIDE ) ) );
+
+            // Contiguous usage must carry on seamlessly.
+            chirpGen.getSamples( actual.data(), NUM_AFTER );
+            double maxAfterErr = 0.0;
+            for ( size_t n = 0; NUM_AFTER != n; ++n )
+                maxAfterErr = std::max( maxAfterErr, std::abs( actual[n] -
+                    exactSample( accel, omegaZero, phi, NUM_BEFORE + NUM_STRIDED * STRIDE + n ) ) );
+
+            std::cout << "Resync Interval " << resyncInterval << ", Strided Max Error: " << maxStridedErr
+                      << ", Subsequent Max Error: " << maxAfterErr << std::endl;
+            if ( maxStridedErr > 1e-10 || maxAfterErr > 1e-10 )
+            {
+                std::cout << "Max Error exceeds 1e-10" << std::endl;
+                retCode = 2;
+                break;
+            }
+        }
+        if ( retCode ) break;
+
+        // A stride of zero is invalid.
+        ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+        FlyingPhasorElementType sample{};
+        try
+        {
+            chirpGen.getSamplesStrided( &sample, 1, 0 );
+            std::cout << "A stride of zero should have thrown" << std::endl;
+            retCode = 3;
+            break;
+        }
+        catch ( const std::invalid_argument & ) {}
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}
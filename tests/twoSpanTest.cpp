@@ -0,0 +1,71 @@
+/**
+ * @file twoSpanTest.cpp
+ * @brief Verifies that the two span getSamples operation fills a wrapped ring buffer seamlessly.
+ *
+ * @authors Frank Reiser
+ * @date Initiated on Oct 18, 2026
+ */
+
+#include "ChirpingPhasorToneGenerator.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+int main()
+{
+    constexpr size_t RING_SIZE = 1000;
+    constexpr size_t CHUNK_SIZE = 384;
+    constexpr size_t NUM_CHUNKS = 20;
+    constexpr auto accel = M_PI / 4096;
+    constexpr auto omegaZero = 0.5;
+    constexpr auto phi = -1.0;
+
+    int retCode = 0;
+
+    // A straight run for reference.
+    ChirpingPhasorToneGenerator refGen{ accel, omegaZero, phi };
+    refGen.setResyncInterval( 777 );
+    std::vector< FlyingPhasorElementType > expected( CHUNK_SIZE * NUM_CHUNKS );
+    refGen.getSamples( expected.data(), expected.size() );
+
+    // Fill the ring chunk by chunk, wrapping where necessary and verify the newest chunk each time.
+    ChirpingPhasorToneGenerator chirpGen{ accel, omegaZero, phi };
+    chirpGen.setResyncInterval( 777 );
+    std::vector< FlyingPhasorElementType > ring( RING_SIZE );
+    size_t writeIndex = 0;
+    do
+    {
+        for ( size_t chunk = 0; NUM_CHUNKS != chunk; ++chunk )
+        {
+            const auto pos = writeIndex % RING_SIZE;
+            const auto numFirst = std::min( CHUNK_SIZE, RING_SIZE - pos );
+            chirpGen.getSamples( ring.data() + pos, numFirst, ring.data(), CHUNK_SIZE - numFirst );
+
+            for ( size_t n = 0; CHUNK_SIZE != n; ++n )
+            {
+                if ( ring[ ( pos + n ) % RING_SIZE ] != expected[ writeIndex + n ] )
+                {
+                    std::cout << "Ring sample " << writeIndex + n << " differs from the straight run" << std::endl;
+                    retCode = 1;
+                    break;
+                }
+            }
+            if ( retCode ) break;
+            writeIndex += CHUNK_SIZE;
+        }
+        if ( retCode ) break;
+
+        if ( writeIndex != chirpGen.getSampleCount() )
+        {
+            std::cout << "Sample Count should be " << writeIndex << " and is " << chirpGen.getSampleCount() << std::endl;
+            retCode = 2;
+            break;
+        }
+    } while (false);
+
+    exit( retCode );
+    return retCode;
+}